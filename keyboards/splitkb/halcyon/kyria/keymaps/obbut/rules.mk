@@ -1,6 +1,9 @@
 ENCODER_MAP_ENABLE = yes
 OS_DETECTION_ENABLE = yes
 
+# Eager press, deferred release debounce with fast keys on the gaming layer
+HLC_DEBOUNCE = yes
+
 # This adds module functionality to your keyboard (files found in users/halcyon_modules)
 USER_NAME := halcyon_modules
 
@@ -8,7 +8,32 @@
 #define SPLIT_POINTING_ENABLE
 #define POINTING_DEVICE_COMBINED
 
-#define HLC_BACKLIGHT_TIMEOUT 120000
+// Idle tiers, entered after this long without input (ms). Dimmed: backlight
+// dimmed, animations and periodic syncs slowed down. Sleep: backlight, RGB and
+// LCD off, animations stopped. The trackpad may sleep in both.
+#define HLC_IDLE_DIM_TIMEOUT 30000
+#define HLC_IDLE_SLEEP_TIMEOUT 120000
+#define HLC_IDLE_DIM_ANIMATION_DIVIDER 4
+#define HLC_IDLE_DIM_SYNC_DIVIDER 2
+#define HLC_IDLE_SLEEP_SYNC_DIVIDER 8
+
+// Dimmed backlight, percentage of the backlight level
+#define HLC_BACKLIGHT_DIM_PERCENT 30
+// Backlight fade durations (ms), fading in on input is kept short
+#define HLC_BACKLIGHT_FADE_IN 150
+#define HLC_BACKLIGHT_FADE_OUT 1000
+
+// Debounce times (ms). Presses are reported at once and then locked for the
+// press time, releases are reported after reading released for the release
+// time. The fast times apply to the keys from debounce_fast_keys_user().
+#define HLC_DEBOUNCE_PRESS 5
+#define HLC_DEBOUNCE_RELEASE 5
+#define HLC_DEBOUNCE_FAST_PRESS 3
+#define HLC_DEBOUNCE_FAST_RELEASE 2
+
+// Profiling (-e HLC_PROFILE=1), samples kept per section and console report interval (ms)
+#define HLC_PROFILE_SAMPLES 64
+#define HLC_PROFILE_REPORT_INTERVAL 5000
 
 #define BACKLIGHT_PWM_DRIVER PWMD5
 #define BACKLIGHT_LEVELS 10
@@ -25,6 +50,7 @@
 #define SPLIT_MODS_ENABLE
 #define SPLIT_LED_STATE_ENABLE
 #define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_ACTIVITY_ENABLE
 
 // Kyria
 #if defined(KEYBOARD_splitkb_halcyon_kyria_rev4)
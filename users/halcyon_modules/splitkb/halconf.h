@@ -5,4 +5,7 @@
 
 #define HAL_USE_PWM TRUE
 
+// Encoder edges (hlc_encoder/hlc_quadrature.c)
+#define PAL_USE_CALLBACKS TRUE
+
 #include_next <halconf.h>
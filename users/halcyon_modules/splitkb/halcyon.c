@@ -3,11 +3,22 @@
 
 #include QMK_KEYBOARD_H
 #include "halcyon.h"
+#include "hlc_backlight.h"
+#include "hlc_idle.h"
+#ifdef HLC_PROFILE
+#    include "hlc_profile.h"
+#endif
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
 #include "transactions.h"
 #include "split_util.h"
+#include "sync_timer.h"
 #include "_wait.h"
 #include "pointing_device.h"
 
+#include "hardware/structs/timer.h"
+
 __attribute__((weak)) void module_suspend_power_down_kb(void);
 __attribute__((weak)) void module_suspend_wakeup_init_kb(void);
 
@@ -21,6 +32,10 @@ __attribute__((weak)) bool display_module_housekeeping_task_kb(bool second_displ
     return display_module_housekeeping_task_user(second_display);
 }
 
+__attribute__((weak)) bool module_raw_hid_receive_kb(uint8_t *data, uint8_t length) {
+    return false;
+}
+
 __attribute__((weak)) bool module_post_init_user(void) {
     return true;
 }
@@ -46,21 +61,26 @@ module_t module;
     module_t module = hlc_tft_display;
 #endif
 
-bool backlight_off = false;
+// Shared time base. On the slave this is the master's timer plus the offset QMK
+// carries on the split transport, so both halves animate on one timeline.
+uint32_t hlc_timer_read32(void) {
+    return sync_timer_read32();
+}
 
-// Timeout handling
-void backlight_wakeup(void) {
-    backlight_off = false;
-    backlight_enable();
-    if (get_backlight_level() == 0) {
-        backlight_level(BACKLIGHT_LEVELS);
-    }
+// Free running microsecond counter of this half, for measuring short durations
+uint32_t hlc_timer_read_us(void) {
+    return timer_hw->timerawl;
 }
 
-// Timeout handling
-void backlight_suspend(void) {
-    backlight_off = true;
-    backlight_disable();
+// Returns true once per period, on the same shared-time boundary on both halves
+bool hlc_timer_tick(uint32_t *last_slot, uint32_t period) {
+    uint32_t slot = hlc_timer_read32() / period;
+
+    if (slot == *last_slot) {
+        return false;
+    }
+    *last_slot = slot;
+    return true;
 }
 
 void module_sync_slave_handler(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer, uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
@@ -69,6 +89,29 @@ void module_sync_slave_handler(uint8_t initiator2target_buffer_size, const void*
     }
 }
 
+#ifdef RAW_ENABLE
+// Raw HID reports go to the profiler and the module, each answers the report
+// IDs it knows and leaves the rest
+static bool hlc_raw_hid_receive(uint8_t *data, uint8_t length) {
+#    ifdef HLC_PROFILE
+    if (hlc_profile_hid_receive(data, length)) {
+        return true;
+    }
+#    endif
+    return module_raw_hid_receive_kb(data, length);
+}
+
+#    ifdef VIA_ENABLE
+bool via_command_kb(uint8_t *data, uint8_t length) {
+    return hlc_raw_hid_receive(data, length);
+}
+#    else
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    hlc_raw_hid_receive(data, length);
+}
+#    endif
+#endif
+
 void suspend_power_down_kb(void) {
     module_suspend_power_down_kb();
 
@@ -76,7 +119,9 @@ void suspend_power_down_kb(void) {
 }
 
 void suspend_wakeup_init_kb(void) {
+    hlc_backlight_reset();
     module_suspend_wakeup_init_kb();
+    hlc_idle_reapply();
 
     suspend_wakeup_init_user();
 }
@@ -92,12 +137,31 @@ void keyboard_post_init_kb(void) {
 
     // Do any post init for modules
     module_post_init_kb();
+    hlc_backlight_reset();
 
     // User post init
     keyboard_post_init_user();
 }
 
+static void display_housekeeping_task(bool second_display) {
+#ifdef HLC_PROFILE
+    uint32_t start = hlc_timer_read_us();
+#endif
+    display_module_housekeeping_task_kb(second_display);
+#ifdef HLC_PROFILE
+    hlc_profile_end(HLC_PROFILE_DISPLAY, start);
+#endif
+}
+
 void housekeeping_task_kb(void) {
+#ifdef HLC_PROFILE
+    uint32_t pass_start = hlc_profile_pass();
+    uint32_t start;
+#endif
+
+    // Backlight, RGB, LCD and trackpad follow the idle tier
+    hlc_idle_task();
+
     if (is_keyboard_master()) {
         static bool synced = false;
 
@@ -111,27 +175,29 @@ void housekeeping_task_kb(void) {
             }
         }
 
-        display_module_housekeeping_task_kb(false); // Is master so can never be the second display
+        display_housekeeping_task(false); // Is master so can never be the second display
     }
 
     if (!is_keyboard_master()) {
-        display_module_housekeeping_task_kb(module_master == hlc_tft_display);
-    }
-
-    // Backlight feature
-    if (last_input_activity_elapsed() <= HLC_BACKLIGHT_TIMEOUT) {
-        if (backlight_off) {
-            backlight_wakeup();
-        }
-    } else {
-        if (!backlight_off) {
-            backlight_suspend();
-        }
+        display_housekeeping_task(module_master == hlc_tft_display);
     }
 
+#ifdef HLC_PROFILE
+    start = hlc_timer_read_us();
+#endif
     module_housekeeping_task_kb();
+#ifdef HLC_PROFILE
+    hlc_profile_end(HLC_PROFILE_MODULE, start);
+    start = hlc_timer_read_us();
+#endif
 
     housekeeping_task_user();
+
+#ifdef HLC_PROFILE
+    hlc_profile_end(HLC_PROFILE_USER, start);
+    hlc_profile_end(HLC_PROFILE_HOUSEKEEPING, pass_start);
+    hlc_profile_report();
+#endif
 }
 
 report_mouse_t pointing_device_task_combined_kb(report_mouse_t left_report, report_mouse_t right_report) {
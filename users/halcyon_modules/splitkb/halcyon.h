@@ -20,4 +20,11 @@ bool module_housekeeping_task_kb(void);
 bool display_module_housekeeping_task_kb(bool second_display);
 bool module_post_init_user(void);
 bool module_housekeeping_task_user(void);
+// Runs on every display pass, also while a frame is going out (display_is_flushing()),
+// leave the lcd and its surface alone until that is false
 bool display_module_housekeeping_task_user(bool second_display);
+bool module_raw_hid_receive_kb(uint8_t *data, uint8_t length);
+
+uint32_t hlc_timer_read32(void);
+uint32_t hlc_timer_read_us(void);
+bool hlc_timer_tick(uint32_t *last_slot, uint32_t period);
@@ -0,0 +1,97 @@
+// Staged, fading backlight for the Halcyon modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The backlight runs at the user's level while the keyboard is in use, and
+// dims or goes off as the idle tier asks (hlc_idle.c). Stage changes fade,
+// input fades back up in HLC_BACKLIGHT_FADE_IN ms. The
+// ramps follow the timer and are written to the PWM channel directly, the
+// ten QMK backlight levels are too coarse for a smooth fade.
+
+#include "halcyon.h"
+#include "hlc_backlight.h"
+
+static hlc_backlight_stage_t stage = HLC_BACKLIGHT_OFF;
+
+// Brightness as perceived, 0-0xFFFF, squared into a PWM duty when written
+static uint16_t brightness = 0;
+static uint16_t ramp_from = 0;
+static uint16_t ramp_to = 0;
+static uint16_t ramp_duration = 0;
+static uint32_t ramp_start = 0;
+
+// User setting the ramps were planned for
+static uint8_t user_level = 0;
+static bool user_enabled = false;
+
+static void write_pwm(uint16_t value) {
+    uint32_t duty = ((uint32_t)value * value) >> 16;
+
+    if (duty == 0) {
+        pwmDisableChannel(&BACKLIGHT_PWM_DRIVER, BACKLIGHT_PWM_CHANNEL - 1);
+    } else {
+        pwmEnableChannel(&BACKLIGHT_PWM_DRIVER, BACKLIGHT_PWM_CHANNEL - 1, PWM_FRACTION_TO_WIDTH(&BACKLIGHT_PWM_DRIVER, 0xFFFF, duty));
+    }
+}
+
+static uint16_t stage_brightness(hlc_backlight_stage_t target) {
+    if (!is_backlight_enabled() || target == HLC_BACKLIGHT_OFF) {
+        return 0;
+    }
+
+    uint32_t full = 0xFFFF * (uint32_t)get_backlight_level() / BACKLIGHT_LEVELS;
+    return target == HLC_BACKLIGHT_DIM ? full * HLC_BACKLIGHT_DIM_PERCENT / 100 : full;
+}
+
+static void start_ramp(uint16_t target, uint16_t duration) {
+    ramp_from = brightness;
+    ramp_to = target;
+    ramp_duration = duration;
+    ramp_start = hlc_timer_read32();
+}
+
+// Makes sure the backlight is on at a visible level, e.g. once both halves are up
+void backlight_wakeup(void) {
+    backlight_enable();
+    if (get_backlight_level() == 0) {
+        backlight_level(BACKLIGHT_LEVELS);
+    }
+}
+
+hlc_backlight_stage_t hlc_backlight_stage(void) {
+    return stage;
+}
+
+// QMK sets the PWM straight to the full level at boot and when the host wakes
+// up, start over from dark so the next task fades in instead
+void hlc_backlight_reset(void) {
+    stage = HLC_BACKLIGHT_OFF;
+    brightness = 0;
+    start_ramp(0, 0);
+    write_pwm(0);
+}
+
+// Fades toward the given stage, called every housekeeping pass
+void hlc_backlight_task(hlc_backlight_stage_t next) {
+    bool user_changed = get_backlight_level() != user_level || is_backlight_enabled() != user_enabled;
+
+    if (user_changed || next != stage) {
+        user_level = get_backlight_level();
+        user_enabled = is_backlight_enabled();
+        stage = next;
+        start_ramp(stage_brightness(stage), stage == HLC_BACKLIGHT_FULL ? HLC_BACKLIGHT_FADE_IN : HLC_BACKLIGHT_FADE_OUT);
+        // QMK writes a level change from a keycode straight away, the ramp takes over from where it was
+        write_pwm(brightness);
+    }
+
+    if (brightness == ramp_to) {
+        return;
+    }
+
+    uint32_t elapsed = TIMER_DIFF_32(hlc_timer_read32(), ramp_start);
+    if (elapsed >= ramp_duration) {
+        brightness = ramp_to;
+    } else {
+        brightness = ramp_from + ((int32_t)ramp_to - ramp_from) * (int32_t)elapsed / ramp_duration;
+    }
+    write_pwm(brightness);
+}
@@ -0,0 +1,17 @@
+// Staged, fading backlight for the Halcyon modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+typedef enum {
+    HLC_BACKLIGHT_FULL,
+    HLC_BACKLIGHT_DIM,
+    HLC_BACKLIGHT_OFF
+} hlc_backlight_stage_t;
+
+void backlight_wakeup(void);
+void hlc_backlight_reset(void);
+void hlc_backlight_task(hlc_backlight_stage_t next);
+hlc_backlight_stage_t hlc_backlight_stage(void);
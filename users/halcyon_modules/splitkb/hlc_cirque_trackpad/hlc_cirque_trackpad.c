@@ -0,0 +1,24 @@
+// Cirque trackpad module for the Halcyon keyboards
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "halcyon.h"
+#include "hlc_idle.h"
+#include "cirque_pinnacle.h"
+
+// Pinnacle SysConfig1 register. With its sleep bit set the pad lowers its scan
+// rate after a few seconds without a touch, and wakes up again on the next one.
+#define PINNACLE_SYSCONFIG1 0x03
+#define PINNACLE_SYSCONFIG1_SLEEP 0x04
+
+// Called from hlc_idle.c
+void module_idle_tier_kb(const hlc_idle_settings_t *settings) {
+    uint8_t config;
+
+    RAP_ReadBytes(PINNACLE_SYSCONFIG1, &config, 1);
+    if (settings->trackpad_sleep) {
+        config |= PINNACLE_SYSCONFIG1_SLEEP;
+    } else {
+        config &= ~PINNACLE_SYSCONFIG1_SLEEP;
+    }
+    RAP_Write(PINNACLE_SYSCONFIG1, config);
+}
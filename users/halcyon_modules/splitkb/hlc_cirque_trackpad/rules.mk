@@ -1 +1,2 @@
+SRC += $(USER_PATH)/splitkb/hlc_cirque_trackpad/hlc_cirque_trackpad.c
 POST_CONFIG_H += $(USER_PATH)/splitkb/hlc_cirque_trackpad/config.h
@@ -0,0 +1,105 @@
+// Eager press, deferred release debounce for the Halcyon keyboards
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A press is reported on the first scan that sees it, after which the key
+// ignores its contacts for the press time. A release is only reported once the
+// key has read released for the release time, bouncing back cancels it. Keys
+// from debounce_fast_keys_user() use the fast press and release times.
+//
+// Every row is handled as a whole with bit operations. Only keys that are
+// locked or waiting to release have a timer, the low byte of the ms timer at
+// which they are done, so timings stay below 128 ms.
+
+#include "hlc_debounce.h"
+#include "debounce.h"
+#include "timer.h"
+
+_Static_assert(HLC_DEBOUNCE_PRESS < 128 && HLC_DEBOUNCE_RELEASE < 128 && HLC_DEBOUNCE_FAST_PRESS < 128 && HLC_DEBOUNCE_FAST_RELEASE < 128, "Debounce times are limited to 127 ms");
+
+static matrix_row_t busy[MATRIX_ROWS];    // Locked after a press, or waiting to release
+static matrix_row_t release[MATRIX_ROWS]; // Waiting to release
+static uint8_t deadline[MATRIX_ROWS][MATRIX_COLS];
+static bool any_busy = false;
+
+__attribute__((weak)) matrix_row_t debounce_fast_keys_user(uint8_t row) {
+    return 0;
+}
+
+static void start_timers(uint8_t *row_deadline, matrix_row_t keys, matrix_row_t fast, uint8_t now, uint8_t time, uint8_t fast_time) {
+    while (keys) {
+        uint8_t col = __builtin_ctz(keys);
+        row_deadline[col] = now + (fast & (1UL << col) ? fast_time : time);
+        keys &= keys - 1;
+    }
+}
+
+static matrix_row_t expired_timers(const uint8_t *row_deadline, matrix_row_t keys, uint8_t now) {
+    matrix_row_t expired = 0;
+
+    while (keys) {
+        uint8_t col = __builtin_ctz(keys);
+        if ((uint8_t)(now - row_deadline[col]) < 128) {
+            expired |= 1UL << col;
+        }
+        keys &= keys - 1;
+    }
+    return expired;
+}
+
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        busy[row] = 0;
+        release[row] = 0;
+    }
+    any_busy = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    // Nothing moved and nothing to time, the usual scan
+    if (!changed && !any_busy) {
+        return false;
+    }
+
+    uint8_t now = (uint8_t)timer_read();
+    bool cooked_changed = false;
+    any_busy = false;
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t r = raw[row];
+        matrix_row_t c = cooked[row];
+        matrix_row_t b = busy[row];
+        matrix_row_t p = release[row];
+
+        if (b) {
+            // Pressed again while waiting to release, the key stays down
+            matrix_row_t bounced = p & r;
+            p &= ~bounced;
+            b &= ~bounced;
+
+            matrix_row_t expired = expired_timers(deadline[row], b, now);
+            c &= ~(expired & p); // Released for the whole release time
+            p &= ~expired;
+            b &= ~expired;
+        }
+
+        matrix_row_t pressed = r & ~c & ~b;
+        matrix_row_t released = c & ~r & ~b;
+        if (pressed | released) {
+            matrix_row_t fast = debounce_fast_keys_user(row);
+            start_timers(deadline[row], pressed, fast, now, HLC_DEBOUNCE_PRESS, HLC_DEBOUNCE_FAST_PRESS);
+            start_timers(deadline[row], released, fast, now, HLC_DEBOUNCE_RELEASE, HLC_DEBOUNCE_FAST_RELEASE);
+            c |= pressed;
+            p |= released;
+            b |= pressed | released;
+        }
+
+        cooked_changed |= c != cooked[row];
+        cooked[row] = c;
+        busy[row] = b;
+        release[row] = p;
+        any_busy |= b != 0;
+    }
+    return cooked_changed;
+}
@@ -0,0 +1,10 @@
+// Eager press, deferred release debounce for the Halcyon keyboards
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Keys of a row of this half that use the fast timings, asked when a key
+// starts to debounce. Rows are numbered per half, as in the debounce call.
+matrix_row_t debounce_fast_keys_user(uint8_t row);
@@ -12,3 +12,6 @@
 #define HLC_ENCODER_A GP27
 #undef HLC_ENCODER_B
 #define HLC_ENCODER_B GP26
+
+// Time the PIO matrix scanner waits after releasing a row (us)
+#define HLC_PIO_MATRIX_UNSELECT_DELAY 5
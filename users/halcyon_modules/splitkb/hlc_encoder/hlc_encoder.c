@@ -4,6 +4,14 @@
 #include "split_util.h"
 #include "atomic_util.h"
 
+#include "hardware/structs/sio.h"
+
+#ifdef HLC_PIO_MATRIX
+#    include "hlc_pio_matrix.h"
+
+static bool pio_matrix = false;
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    define ROWS_PER_HAND (MATRIX_ROWS / 2)
 #else
@@ -36,9 +44,93 @@ static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
 #    endif // MATRIX_COL_PINS
 #endif
 
+// Columns are sampled with one read of the SIO input register per row. Columns
+// whose GPIO sits at the same distance from their column bit form a run that
+// is masked and shifted into place in one go, built per half at init.
+typedef struct {
+    uint32_t mask;        // GPIOs of the run
+    uint8_t  right_shift; // From GPIO number down to column bit
+    uint8_t  left_shift;  // Or up, when the GPIO number is lower
+} col_run_t;
+
+typedef struct {
+    col_run_t runs[MATRIX_COLS];
+    uint8_t   count;
+#ifdef HLC_MATRIX_PIN_READS
+    const pin_t *pins;
+    uint8_t      pin_count;
+#endif
+} col_reader_t;
+
+// The last row only holds the encoder button, wired straight to a GPIO. It is
+// read like a row of direct pins, without selecting a row pin or waiting.
+#define DIRECT_ROW (ROWS_PER_HAND - 1)
+static const pin_t direct_row_pins[] = { HLC_ENCODER_BUTTON };
+
+static col_reader_t matrix_cols;
+static col_reader_t direct_cols;
+
+static void init_col_reader(col_reader_t *reader, const pin_t *pins, uint8_t count) {
+    reader->count = 0;
+#ifdef HLC_MATRIX_PIN_READS
+    reader->pins = pins;
+    reader->pin_count = count;
+#endif
+
+    for (uint8_t col = 0; col < count; col++) {
+        if (pins[col] == NO_PIN) {
+            continue;
+        }
+
+        uint8_t gpio = PAL_PAD(pins[col]);
+        uint8_t right_shift = gpio > col ? gpio - col : 0;
+        uint8_t left_shift = col > gpio ? col - gpio : 0;
+        uint8_t run = 0;
+        while (run < reader->count && (reader->runs[run].right_shift != right_shift || reader->runs[run].left_shift != left_shift)) run++;
+        if (run == reader->count) {
+            reader->runs[reader->count++] = (col_run_t){ .mask = 0, .right_shift = right_shift, .left_shift = left_shift };
+        }
+        reader->runs[run].mask |= 1UL << gpio;
+    }
+}
+
+static inline matrix_row_t read_cols_from(const col_reader_t *reader, uint32_t gpio_in) {
+    uint32_t pressed = gpio_in;
+#if MATRIX_INPUT_PRESSED_STATE == 0
+    pressed = ~pressed;
+#endif
+    matrix_row_t row = 0;
+
+    for (uint8_t i = 0; i < reader->count; i++) {
+        row |= ((pressed & reader->runs[i].mask) >> reader->runs[i].right_shift) << reader->runs[i].left_shift;
+    }
+    return row;
+}
+
+#ifdef HLC_MATRIX_PIN_READS
+// The column read from before the register reads, a gpio_read_pin() per
+// column, kept to compare scan rates against with HLC_PROFILE
+static inline matrix_row_t read_cols(const col_reader_t *reader) {
+    matrix_row_t row = 0;
+
+    for (uint8_t col = 0; col < reader->pin_count; col++) {
+        if (reader->pins[col] != NO_PIN && gpio_read_pin(reader->pins[col]) == MATRIX_INPUT_PRESSED_STATE) {
+            row |= (matrix_row_t)1 << col;
+        }
+    }
+    return row;
+}
+#else
+static inline matrix_row_t read_cols(const col_reader_t *reader) {
+    return read_cols_from(reader, sio_hw->gpio_in);
+}
+#endif
+
 void matrix_init_kb(void) {
 
-    gpio_set_pin_input_high(HLC_ENCODER_BUTTON);
+    for (uint8_t col = 0; col < ARRAY_SIZE(direct_row_pins); col++) {
+        gpio_set_pin_input_high(direct_row_pins[col]);
+    }
 
     // Also need to define here otherwise right half is swapped
     if (!isLeftHand) {
@@ -55,6 +147,13 @@ void matrix_init_kb(void) {
                 }
         #    endif
     }
+
+    init_col_reader(&matrix_cols, col_pins, MATRIX_COLS);
+    init_col_reader(&direct_cols, direct_row_pins, ARRAY_SIZE(direct_row_pins));
+
+#ifdef HLC_PIO_MATRIX
+    pio_matrix = hlc_pio_matrix_init(row_pins, DIRECT_ROW);
+#endif
 }
 
 static inline void setPinOutput_writeLow(pin_t pin) {
@@ -77,14 +176,6 @@ static inline void setPinInputHigh_atomic(pin_t pin) {
     }
 }
 
-static inline uint8_t readMatrixPin(pin_t pin) {
-    if (pin != NO_PIN) {
-        return (gpio_read_pin(pin) == MATRIX_INPUT_PRESSED_STATE) ? 0 : 1;
-    } else {
-        return 1;
-    }
-}
-
 // THIS FUNCTION IS CHANGED, removed NO_PIN check
 static bool select_row(uint8_t row) {
     pin_t pin = row_pins[row];
@@ -104,28 +195,28 @@ static void unselect_row(uint8_t row) {
 }
 
 void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
-    // Start with a clear matrix row
-    matrix_row_t current_row_value = 0;
+    // ↓↓↓ THIS HAS BEEN ADDED/CHANGED
+    if (current_row == DIRECT_ROW) {
+        current_matrix[current_row] = read_cols(&direct_cols);
+        return;
+    }
+    // ↑↑↑ THIS HAS BEEN ADDED/CHANGED
+
+#ifdef HLC_PIO_MATRIX
+    if (pio_matrix) {
+        // Scanned by the PIO, take the latest sample of the row
+        current_matrix[current_row] = read_cols_from(&matrix_cols, hlc_pio_matrix_read(current_row));
+        return;
+    }
+#endif
 
     if (!select_row(current_row)) { // Select row
         return;                     // skip NO_PIN row
     }
     matrix_output_select_delay();
 
-    // ↓↓↓ THIS HAS BEEN ADDED/CHANGED
-    if (current_row == (ROWS_PER_HAND - 1)) {
-        current_row_value |= ((!gpio_read_pin(HLC_ENCODER_BUTTON)) & 1) << 0;
-    } else {
-        // For each col...
-        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
-            uint8_t pin_state = readMatrixPin(col_pins[col_index]);
-
-            // Populate the matrix row with the state of the col pin
-            current_row_value |= pin_state ? 0 : row_shifter;
-        }
-    }
-    // ↑↑↑ THIS HAS BEEN ADDED/CHANGED
+    // All columns at once
+    matrix_row_t current_row_value = read_cols(&matrix_cols);
 
     // Unselect row
     unselect_row(current_row);
@@ -0,0 +1,177 @@
+// PIO matrix scanning for the Halcyon keyboards
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Matrix scanning on a PIO state machine. The state machine drives one row
+// low at a time, samples every GPIO and releases the row again. One DMA
+// channel feeds it the row to select from a ring of slots, another writes
+// each sample into a matching ring in RAM. Both run on their own, the CPU only
+// reads the latest sample of a row.
+
+#include "quantum.h"
+#include "hlc_pio_matrix.h"
+
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+
+// The serial split and WS2812 drivers claim PIO0 by default. The state machine
+// writes the direction of every pin in the row span, so it needs a PIO where
+// no other state machine drives those pins.
+#ifdef HLC_PIO_MATRIX_USE_PIO0
+static const PIO pio = pio0;
+#else
+static const PIO pio = pio1;
+#endif
+
+#ifndef HLC_PIO_MATRIX_DMA_PRIORITY
+#    define HLC_PIO_MATRIX_DMA_PRIORITY 3
+#endif
+
+// State machine clock, one cycle is 250 ns
+#define PIO_FREQUENCY 4000000
+// Cycles between driving a row and sampling the columns
+#define SELECT_DELAY 3
+
+// Rings of 4 or 8 slots, the DMA address wraps at a power of two. Slots past
+// the last row select nothing. The encoder button row is not scanned.
+#define SLOT_COUNT (MATRIX_ROWS / 2 - 1 <= 4 ? 4 : 8)
+#define SLOT_RING_BITS (SLOT_COUNT == 4 ? 4 : 5) // log2 of the ring size in bytes
+
+static uint32_t select_ring[SLOT_COUNT] __attribute__((aligned(SLOT_COUNT * 4)));
+static volatile uint32_t sample_ring[SLOT_COUNT] __attribute__((aligned(SLOT_COUNT * 4)));
+
+static const rp_dma_channel_t *select_dma;
+static const rp_dma_channel_t *sample_dma;
+static int sm;
+
+// .program hlc_matrix
+//     pull block                   ; Unselect delay, sent once before the DMA starts
+//     mov y, osr
+// .wrap_target
+//     pull block                   ; Row of the next slot
+//     out pindirs, <span> [SELECT_DELAY]
+//     in pins, 32                  ; Sample every GPIO, autopush
+//     mov osr, null
+//     out pindirs, <span>          ; Release the row, pull-ups bring it back
+//     mov x, y
+// delay:
+//     jmp x-- delay
+// .wrap
+//
+// The span depends on the row pins of the half, so the program is put
+// together at init.
+#define PROGRAM_WRAP_TARGET 2
+#define PROGRAM_LENGTH 9
+static uint16_t program_instructions[PROGRAM_LENGTH];
+
+static void build_program(uint8_t span) {
+    program_instructions[0] = pio_encode_pull(false, true);
+    program_instructions[1] = pio_encode_mov(pio_y, pio_osr);
+    program_instructions[2] = pio_encode_pull(false, true);
+    program_instructions[3] = pio_encode_out(pio_pindirs, span) | pio_encode_delay(SELECT_DELAY);
+    program_instructions[4] = pio_encode_in(pio_pins, 32);
+    program_instructions[5] = pio_encode_mov(pio_osr, pio_null);
+    program_instructions[6] = pio_encode_out(pio_pindirs, span);
+    program_instructions[7] = pio_encode_mov(pio_x, pio_y);
+    program_instructions[8] = pio_encode_jmp_x_dec(8);
+}
+
+static void start_dma(void) {
+    // Counts run out after some hours of scanning, the ring addresses carry on
+    // where they were when restarted
+    dmaChannelSetCounterX(sample_dma, UINT32_MAX);
+    dmaChannelSetCounterX(select_dma, UINT32_MAX);
+    dmaChannelEnableX(sample_dma);
+    dmaChannelEnableX(select_dma);
+}
+
+// Returns false when there is no room on the PIO, the CPU keeps scanning then
+bool hlc_pio_matrix_init(const pin_t *row_pins, uint8_t rows) {
+    uint8_t base = 31;
+    uint8_t last = 0;
+
+    for (uint8_t row = 0; row < rows; row++) {
+        if (row_pins[row] != NO_PIN) {
+            base = MIN(base, PAL_PAD(row_pins[row]));
+            last = MAX(last, PAL_PAD(row_pins[row]));
+        }
+    }
+    if (last < base || rows > SLOT_COUNT) {
+        return false;
+    }
+
+    uint8_t span = last - base + 1;
+    for (uint8_t slot = 0; slot < SLOT_COUNT; slot++) {
+        select_ring[slot] = slot < rows && row_pins[slot] != NO_PIN ? 1UL << (PAL_PAD(row_pins[slot]) - base) : 0;
+        sample_ring[slot] = UINT32_MAX; // Released until sampled
+    }
+
+    uint pio_idx = pio_get_index(pio);
+    hal_lld_peripheral_unreset(pio_idx == 0 ? RESETS_ALLREG_PIO0 : RESETS_ALLREG_PIO1);
+
+    build_program(span);
+    const pio_program_t program = {
+        .instructions = program_instructions,
+        .length       = PROGRAM_LENGTH,
+        .origin       = -1,
+    };
+    if (!pio_can_add_program(pio, &program)) {
+        return false;
+    }
+
+    // Everything that can run out is taken before any pin changes hands
+    select_dma = dmaChannelAllocI(RP_DMA_CHANNEL_ID_ANY, HLC_PIO_MATRIX_DMA_PRIORITY, NULL, NULL);
+    sample_dma = dmaChannelAllocI(RP_DMA_CHANNEL_ID_ANY, HLC_PIO_MATRIX_DMA_PRIORITY, NULL, NULL);
+    sm = pio_claim_unused_sm(pio, false);
+    if (select_dma == NULL || sample_dma == NULL || sm < 0) {
+        if (select_dma != NULL) dmaChannelFreeI(select_dma);
+        if (sample_dma != NULL) dmaChannelFreeI(sample_dma);
+        if (sm >= 0) pio_sm_unclaim(pio, sm);
+        return false;
+    }
+    uint offset = pio_add_program(pio, &program);
+
+    // Rows idle as pulled up inputs and are only ever driven low
+    uint32_t row_mask = 0;
+    for (uint8_t row = 0; row < rows; row++) {
+        if (row_pins[row] != NO_PIN) {
+            palSetLineMode(row_pins[row], PAL_RP_PAD_PUE | (pio_idx == 0 ? PAL_MODE_ALTERNATE_PIO0 : PAL_MODE_ALTERNATE_PIO1));
+            row_mask |= 1UL << PAL_PAD(row_pins[row]);
+        }
+    }
+    pio_sm_set_pins_with_mask(pio, sm, 0, row_mask);
+    pio_sm_set_pindirs_with_mask(pio, sm, 0, row_mask);
+
+    pio_sm_config config = pio_get_default_sm_config();
+    sm_config_set_wrap(&config, offset + PROGRAM_WRAP_TARGET, offset + PROGRAM_LENGTH - 1);
+    sm_config_set_out_pins(&config, base, span);
+    sm_config_set_out_shift(&config, true, false, 32);
+    sm_config_set_in_pins(&config, 0);
+    sm_config_set_in_shift(&config, false, true, 32);
+    sm_config_set_clkdiv(&config, (float)clock_get_hz(clk_sys) / PIO_FREQUENCY);
+    pio_sm_init(pio, sm, offset, &config);
+
+    // Cycles in the delay loop, which gives the columns time to recover
+    pio_sm_put(pio, sm, HLC_PIO_MATRIX_UNSELECT_DELAY * (PIO_FREQUENCY / 1000000));
+    pio_sm_set_enabled(pio, sm, true);
+
+    dmaChannelClearErrorX(select_dma);
+    dmaChannelSetModeX(select_dma, DMA_CTRL_TRIG_INCR_READ | DMA_CTRL_TRIG_DATA_SIZE_WORD | DMA_CTRL_TRIG_IRQ_QUIET | DMA_CTRL_TRIG_RING_SIZE(SLOT_RING_BITS) | DMA_CTRL_TRIG_TREQ_SEL(pio_get_dreq(pio, sm, true)));
+    dmaChannelSetSourceX(select_dma, (uint32_t)select_ring);
+    dmaChannelSetDestinationX(select_dma, (uint32_t)&pio->txf[sm]);
+
+    dmaChannelClearErrorX(sample_dma);
+    dmaChannelSetModeX(sample_dma, DMA_CTRL_TRIG_INCR_WRITE | DMA_CTRL_TRIG_DATA_SIZE_WORD | DMA_CTRL_TRIG_IRQ_QUIET | DMA_CTRL_TRIG_RING_SEL | DMA_CTRL_TRIG_RING_SIZE(SLOT_RING_BITS) | DMA_CTRL_TRIG_TREQ_SEL(pio_get_dreq(pio, sm, false)));
+    dmaChannelSetSourceX(sample_dma, (uint32_t)&pio->rxf[sm]);
+    dmaChannelSetDestinationX(sample_dma, (uint32_t)sample_ring);
+
+    start_dma();
+    return true;
+}
+
+// Latest sample of all GPIOs while the row was selected
+uint32_t hlc_pio_matrix_read(uint8_t row) {
+    if (row == 0 && !dmaChannelIsBusyX(sample_dma)) {
+        start_dma();
+    }
+    return sample_ring[row];
+}
@@ -0,0 +1,11 @@
+// PIO matrix scanning for the Halcyon keyboards
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio.h"
+
+bool hlc_pio_matrix_init(const pin_t *row_pins, uint8_t rows);
+uint32_t hlc_pio_matrix_read(uint8_t row);
@@ -0,0 +1,120 @@
+// Interrupt driven quadrature decoding for the Halcyon encoders
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Edge triggered quadrature decoding, replaces the polled QMK driver
+// (ENCODER_DRIVER = custom). Every edge on an A or B pin raises an interrupt
+// that steps the signed pulse count of its encoder, so no transition is lost
+// while the main loop is busy drawing. The encoder task only drains the counts
+// into detents.
+
+#include "quantum.h"
+#include "encoder.h"
+#include "split_util.h"
+#include "atomic_util.h"
+
+#include "hardware/structs/sio.h"
+
+#if defined(SPLIT_KEYBOARD) && defined(ENCODER_A_PINS_RIGHT)
+#    define ENCODERS_THIS_HAND (isLeftHand ? NUM_ENCODERS_LEFT : NUM_ENCODERS_RIGHT)
+#else
+#    define ENCODERS_THIS_HAND NUM_ENCODERS_LEFT
+#endif
+
+#ifndef ENCODER_RESOLUTION
+#    define ENCODER_RESOLUTION 4
+#endif
+
+static pin_t encoders_pad_a[NUM_ENCODERS_MAX_PER_SIDE] = ENCODER_A_PINS;
+static pin_t encoders_pad_b[NUM_ENCODERS_MAX_PER_SIDE] = ENCODER_B_PINS;
+
+#ifdef ENCODER_RESOLUTIONS
+static uint8_t encoder_resolutions[NUM_ENCODERS] = ENCODER_RESOLUTIONS;
+#endif
+
+// Same table as the QMK driver, previous and current AB state to a step
+static const int8_t encoder_lut[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+// Written in the interrupt
+static volatile uint8_t encoder_state[NUM_ENCODERS_MAX_PER_SIDE];
+static volatile int16_t encoder_steps[NUM_ENCODERS_MAX_PER_SIDE];
+
+// Steps drained but not yet a full detent
+static int8_t encoder_pulses[NUM_ENCODERS_MAX_PER_SIDE];
+
+static inline uint8_t read_state(uint8_t i) {
+    uint32_t gpio_in = sio_hw->gpio_in;
+    return ((gpio_in >> PAL_PAD(encoders_pad_a[i])) & 1) | (((gpio_in >> PAL_PAD(encoders_pad_b[i])) & 1) << 1);
+}
+
+static void encoder_edge_cb(void *arg) {
+    uint8_t i     = (uintptr_t)arg;
+    uint8_t state = read_state(i);
+
+    if ((encoder_state[i] & 0x3) != state) {
+        encoder_state[i] = (encoder_state[i] << 2) | state;
+        encoder_steps[i] += encoder_lut[encoder_state[i] & 0xF];
+    }
+}
+
+void encoder_driver_init(void) {
+#if defined(SPLIT_KEYBOARD) && defined(ENCODER_A_PINS_RIGHT) && defined(ENCODER_B_PINS_RIGHT)
+    if (!isLeftHand) {
+        const pin_t encoders_pad_a_right[NUM_ENCODERS_RIGHT] = ENCODER_A_PINS_RIGHT;
+        const pin_t encoders_pad_b_right[NUM_ENCODERS_RIGHT] = ENCODER_B_PINS_RIGHT;
+        for (uint8_t i = 0; i < NUM_ENCODERS_RIGHT; i++) {
+            encoders_pad_a[i] = encoders_pad_a_right[i];
+            encoders_pad_b[i] = encoders_pad_b_right[i];
+        }
+    }
+#endif
+
+    for (uint8_t i = 0; i < ENCODERS_THIS_HAND; i++) {
+        if (encoders_pad_a[i] == NO_PIN || encoders_pad_b[i] == NO_PIN) {
+            continue;
+        }
+
+        gpio_set_pin_input_high(encoders_pad_a[i]);
+        gpio_set_pin_input_high(encoders_pad_b[i]);
+        wait_us(100);
+        encoder_state[i] = read_state(i);
+
+        palSetLineCallback(encoders_pad_a[i], encoder_edge_cb, (void *)(uintptr_t)i);
+        palSetLineCallback(encoders_pad_b[i], encoder_edge_cb, (void *)(uintptr_t)i);
+        palEnableLineEvent(encoders_pad_a[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palEnableLineEvent(encoders_pad_b[i], PAL_EVENT_MODE_BOTH_EDGES);
+    }
+}
+
+void encoder_driver_task(void) {
+    uint8_t index_offset = isLeftHand ? 0 : NUM_ENCODERS_LEFT;
+
+    for (uint8_t i = 0; i < ENCODERS_THIS_HAND; i++) {
+        int16_t steps;
+        ATOMIC_BLOCK_FORCEON {
+            steps            = encoder_steps[i];
+            encoder_steps[i] = 0;
+        }
+        if (steps == 0) {
+            continue;
+        }
+
+        uint8_t index = i + index_offset;
+#ifdef ENCODER_RESOLUTIONS
+        int8_t resolution = encoder_resolutions[index];
+#else
+        int8_t resolution = ENCODER_RESOLUTION;
+#endif
+        int16_t pulses = encoder_pulses[i] + steps;
+
+        // Directions as in the QMK driver
+        while (pulses >= resolution) {
+            encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            pulses -= resolution;
+        }
+        while (pulses <= -resolution) {
+            encoder_queue_event(index, ENCODER_CLOCKWISE);
+            pulses += resolution;
+        }
+        encoder_pulses[i] = pulses;
+    }
+}
@@ -1,2 +1,18 @@
 SRC += $(USER_PATH)/splitkb/hlc_encoder/hlc_encoder.c
 POST_CONFIG_H += $(USER_PATH)/splitkb/hlc_encoder/config.h
+
+# Encoders decoded from pin change interrupts instead of polling
+ENCODER_DRIVER = custom
+SRC += $(USER_PATH)/splitkb/hlc_encoder/hlc_quadrature.c
+
+# Columns read a pin at a time like before the single register reads, to
+# compare scan rates with HLC_PROFILE, enable with `-e HLC_MATRIX_PIN_READS=1`
+ifdef HLC_MATRIX_PIN_READS
+  OPT_DEFS += -DHLC_MATRIX_PIN_READS
+endif
+
+# Matrix scanned by a PIO state machine and DMA, enable with `-e HLC_PIO_MATRIX=1`
+ifdef HLC_PIO_MATRIX
+  SRC += $(USER_PATH)/splitkb/hlc_encoder/hlc_pio_matrix.c
+  OPT_DEFS += -DHLC_PIO_MATRIX
+endif
@@ -0,0 +1,114 @@
+// Idle tiers for the Halcyon keyboards and modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// One place decides how idle the keyboard is and sets every peripheral to
+// match: backlight, RGB matrix, LCD power, display animation rate, trackpad
+// sleep and periodic split syncs. Both halves follow the same input activity
+// (SPLIT_ACTIVITY_ENABLE), so they change tier together.
+
+#include "halcyon.h"
+#include "hlc_idle.h"
+
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif
+
+static const hlc_idle_settings_t idle_tiers[HLC_IDLE_TIER_COUNT] = {
+    [HLC_IDLE_ACTIVE] = {
+        .timeout = 0,
+        .backlight = HLC_BACKLIGHT_FULL,
+        .animation_divider = 1,
+        .sync_divider = 1,
+        .rgb = true,
+        .lcd = true,
+        .trackpad_sleep = false,
+    },
+    [HLC_IDLE_DIM] = {
+        .timeout = HLC_IDLE_DIM_TIMEOUT,
+        .backlight = HLC_BACKLIGHT_DIM,
+        .animation_divider = HLC_IDLE_DIM_ANIMATION_DIVIDER,
+        .sync_divider = HLC_IDLE_DIM_SYNC_DIVIDER,
+        .rgb = true,
+        .lcd = true,
+        .trackpad_sleep = true,
+    },
+    [HLC_IDLE_SLEEP] = {
+        .timeout = HLC_IDLE_SLEEP_TIMEOUT,
+        .backlight = HLC_BACKLIGHT_OFF,
+        .animation_divider = 0,
+        .sync_divider = HLC_IDLE_SLEEP_SYNC_DIVIDER,
+        .rgb = false,
+        .lcd = false,
+        .trackpad_sleep = true,
+    },
+};
+
+static hlc_idle_tier_t current_tier = HLC_IDLE_TIER_COUNT; // Nothing applied yet
+static uint32_t tier_time[HLC_IDLE_TIER_COUNT];
+static uint32_t last_update = 0;
+
+__attribute__((weak)) void module_idle_tier_kb(const hlc_idle_settings_t *settings) {}
+
+static hlc_idle_tier_t idle_tier_for(uint32_t idle) {
+    hlc_idle_tier_t tier = HLC_IDLE_ACTIVE;
+
+    while (tier + 1 < HLC_IDLE_TIER_COUNT && idle > idle_tiers[tier + 1].timeout) {
+        tier++;
+    }
+    return tier;
+}
+
+static void apply_tier(hlc_idle_tier_t tier) {
+    const hlc_idle_settings_t *settings = &idle_tiers[tier];
+
+#ifdef RGB_MATRIX_ENABLE
+    rgb_matrix_set_suspend_state(!settings->rgb);
+#endif
+    module_idle_tier_kb(settings);
+}
+
+void hlc_idle_task(void) {
+    uint32_t now = timer_read32();
+    hlc_idle_tier_t tier = idle_tier_for(last_input_activity_elapsed());
+
+    if (current_tier < HLC_IDLE_TIER_COUNT) {
+        tier_time[current_tier] += TIMER_DIFF_32(now, last_update);
+    }
+    last_update = now;
+
+    if (tier != current_tier) {
+        if (current_tier < HLC_IDLE_TIER_COUNT) {
+            dprintf("idle: tier %u after %lu ms in tier %u\n", tier, (unsigned long)tier_time[current_tier], current_tier);
+        }
+        current_tier = tier;
+        apply_tier(tier);
+    }
+
+    hlc_backlight_task(idle_tiers[current_tier].backlight);
+}
+
+// Sets the peripherals to the current tier again, after something outside the
+// tiers changed them. Waking from suspend turns the RGB matrix back on.
+void hlc_idle_reapply(void) {
+    if (current_tier < HLC_IDLE_TIER_COUNT) {
+        apply_tier(current_tier);
+    }
+}
+
+hlc_idle_tier_t hlc_idle_tier(void) {
+    return current_tier < HLC_IDLE_TIER_COUNT ? current_tier : HLC_IDLE_ACTIVE;
+}
+
+const hlc_idle_settings_t *hlc_idle_settings(void) {
+    return &idle_tiers[hlc_idle_tier()];
+}
+
+// Stretches the period of a periodic split sync for the current tier
+uint32_t hlc_idle_sync_interval(uint32_t interval) {
+    return interval * hlc_idle_settings()->sync_divider;
+}
+
+// Total time spent in a tier since boot (ms), for power profiling
+uint32_t hlc_idle_time_in_tier(hlc_idle_tier_t tier) {
+    return tier < HLC_IDLE_TIER_COUNT ? tier_time[tier] : 0;
+}
@@ -0,0 +1,36 @@
+// Idle tiers for the Halcyon keyboards and modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hlc_backlight.h"
+
+typedef enum {
+    HLC_IDLE_ACTIVE,
+    HLC_IDLE_DIM,
+    HLC_IDLE_SLEEP,
+    HLC_IDLE_TIER_COUNT
+} hlc_idle_tier_t;
+
+// What the peripherals do in a tier
+typedef struct {
+    uint32_t timeout;           // Time without input after which the tier starts (ms)
+    hlc_backlight_stage_t backlight;
+    uint8_t  animation_divider; // Display animations run at 1/n of their rate, 0 stops them
+    uint8_t  sync_divider;      // Periodic split syncs run at 1/n of their rate
+    bool     rgb;               // RGB matrix lit
+    bool     lcd;               // LCD powered
+    bool     trackpad_sleep;    // Trackpad may drop into its low power mode
+} hlc_idle_settings_t;
+
+void hlc_idle_task(void);
+void hlc_idle_reapply(void);
+hlc_idle_tier_t hlc_idle_tier(void);
+const hlc_idle_settings_t *hlc_idle_settings(void);
+uint32_t hlc_idle_sync_interval(uint32_t interval);
+uint32_t hlc_idle_time_in_tier(hlc_idle_tier_t tier);
+
+// Called on each tier change, implemented by the module
+void module_idle_tier_kb(const hlc_idle_settings_t *settings);
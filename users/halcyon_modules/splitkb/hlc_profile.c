@@ -0,0 +1,140 @@
+// Section timings for the Halcyon keyboards and modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Times the parts of every housekeeping pass with the microsecond timer of the
+// half and keeps the last HLC_PROFILE_SAMPLES of each section in a ring. Every
+// HLC_PROFILE_REPORT_INTERVAL ms the console gets min, average and max per
+// section plus the scan rate. QMK scans the matrix once per main loop, so the
+// scan rate is the housekeeping pass rate. Each half reports its own numbers.
+//
+// The master half also answers raw HID reports starting with HID_PROFILE_ID and
+// a section number with its stats, in place and little endian:
+//
+//   HID_PROFILE_ID, section, status, samples, min, avg, max, scans/s (32 bit each)
+//
+// Status is 0, or 1 for an unknown section. halcyon.c hands the reports over.
+
+#include "halcyon.h"
+#include "hlc_profile.h"
+#include "raw_hid.h"
+
+#define HID_PROFILE_ID 0x49 // Next to the display stream, not used by VIA
+
+static const char *const section_names[HLC_PROFILE_SECTION_COUNT] = {
+    [HLC_PROFILE_LOOP]         = "loop",
+    [HLC_PROFILE_HOUSEKEEPING] = "housekeeping",
+    [HLC_PROFILE_DISPLAY]      = "display",
+    [HLC_PROFILE_MODULE]       = "module",
+    [HLC_PROFILE_USER]         = "user",
+    [HLC_PROFILE_INDICATORS]   = "indicators",
+};
+
+static uint32_t samples[HLC_PROFILE_SECTION_COUNT][HLC_PROFILE_SAMPLES];
+static uint8_t sample_next[HLC_PROFILE_SECTION_COUNT];
+static uint8_t sample_count[HLC_PROFILE_SECTION_COUNT];
+
+static uint32_t last_pass = 0;
+static uint32_t window_start = 0;
+static uint32_t window_passes = 0;
+static uint32_t scan_rate = 0;
+static uint32_t last_report = 0;
+
+static void record(hlc_profile_section_t section, uint32_t elapsed) {
+    samples[section][sample_next[section]] = elapsed;
+    sample_next[section] = (sample_next[section] + 1) % HLC_PROFILE_SAMPLES;
+    if (sample_count[section] < HLC_PROFILE_SAMPLES) {
+        sample_count[section]++;
+    }
+}
+
+// Called at the start of every housekeeping pass, returns its start time
+uint32_t hlc_profile_pass(void) {
+    uint32_t now = hlc_timer_read_us();
+
+    if (window_passes > 0) {
+        record(HLC_PROFILE_LOOP, now - last_pass);
+    } else {
+        window_start = now;
+    }
+    last_pass = now;
+
+    window_passes++;
+    if (now - window_start >= 1000000) {
+        scan_rate = (uint64_t)(window_passes - 1) * 1000000 / (now - window_start);
+        window_start = now;
+        window_passes = 1;
+    }
+    return now;
+}
+
+void hlc_profile_end(hlc_profile_section_t section, uint32_t start) {
+    record(section, hlc_timer_read_us() - start);
+}
+
+void hlc_profile_stats(hlc_profile_section_t section, hlc_profile_stats_t *stats) {
+    uint8_t count = sample_count[section];
+    uint64_t sum = 0;
+
+    stats->min = count ? UINT32_MAX : 0;
+    stats->max = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t sample = samples[section][i];
+        sum += sample;
+        stats->min = MIN(stats->min, sample);
+        stats->max = MAX(stats->max, sample);
+    }
+    stats->avg = count ? sum / count : 0;
+    stats->samples = count;
+}
+
+// Matrix scans per second over the last full second
+uint32_t hlc_profile_scan_rate(void) {
+    return scan_rate;
+}
+
+// Prints the stats now and then, call once per pass
+void hlc_profile_report(void) {
+    if (timer_elapsed32(last_report) < HLC_PROFILE_REPORT_INTERVAL) {
+        return;
+    }
+    last_report = timer_read32();
+
+    dprintf("profile: %lu scans/s\n", (unsigned long)scan_rate);
+    for (uint8_t section = 0; section < HLC_PROFILE_SECTION_COUNT; section++) {
+        hlc_profile_stats_t stats;
+        hlc_profile_stats(section, &stats);
+        if (stats.samples == 0) {
+            continue;
+        }
+        dprintf("profile: %-12s min %5lu avg %5lu max %5lu us\n", section_names[section], (unsigned long)stats.min, (unsigned long)stats.avg, (unsigned long)stats.max);
+    }
+}
+
+static void put_u32(uint8_t *data, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        data[i] = value >> (8 * i);
+    }
+}
+
+// Answers a stats report, returns false for reports of other features
+bool hlc_profile_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 20 || data[0] != HID_PROFILE_ID) {
+        return false;
+    }
+
+    uint8_t section = data[1];
+    memset(&data[2], 0, length - 2);
+    if (section < HLC_PROFILE_SECTION_COUNT) {
+        hlc_profile_stats_t stats;
+        hlc_profile_stats(section, &stats);
+        data[3] = stats.samples;
+        put_u32(&data[4], stats.min);
+        put_u32(&data[8], stats.avg);
+        put_u32(&data[12], stats.max);
+        put_u32(&data[16], scan_rate);
+    } else {
+        data[2] = 1;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
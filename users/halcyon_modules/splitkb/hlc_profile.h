@@ -0,0 +1,31 @@
+// Section timings for the Halcyon keyboards and modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    HLC_PROFILE_LOOP,         // From one housekeeping pass to the next, a matrix scan each
+    HLC_PROFILE_HOUSEKEEPING, // The whole of housekeeping_task_kb
+    HLC_PROFILE_DISPLAY,      // display_module_housekeeping_task_kb
+    HLC_PROFILE_MODULE,       // module_housekeeping_task_kb
+    HLC_PROFILE_USER,         // housekeeping_task_user
+    HLC_PROFILE_INDICATORS,   // RGB matrix indicators
+    HLC_PROFILE_SECTION_COUNT
+} hlc_profile_section_t;
+
+typedef struct {
+    uint32_t min; // us
+    uint32_t avg;
+    uint32_t max;
+    uint8_t  samples;
+} hlc_profile_stats_t;
+
+uint32_t hlc_profile_pass(void);
+void hlc_profile_end(hlc_profile_section_t section, uint32_t start);
+void hlc_profile_stats(hlc_profile_section_t section, hlc_profile_stats_t *stats);
+uint32_t hlc_profile_scan_rate(void);
+void hlc_profile_report(void);
+bool hlc_profile_hid_receive(uint8_t *data, uint8_t length);
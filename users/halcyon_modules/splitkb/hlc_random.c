@@ -0,0 +1,50 @@
+// Fast random numbers for the Halcyon modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "hlc_random.h"
+#include "timer.h"
+
+#include "hardware/structs/rosc.h"
+
+// xorshift32 state, must never be zero
+static uint32_t random_state = 0x2545F491;
+
+// Finalizer from murmur3, spreads the few truly random bits over the whole word
+static uint32_t mix32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x85EBCA6B;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35;
+    x ^= x >> 16;
+    return x;
+}
+
+// Seeds the generator from the ring oscillator. The bits are read back to back
+// without sleeping, consecutive reads are correlated so more are folded in than
+// needed and the result is mixed.
+void hlc_random_seed(void) {
+    uint32_t entropy = timer_read32();
+
+    for (uint8_t i = 0; i < 128; i++) {
+        entropy = (entropy << 1 | entropy >> 31) ^ (rosc_hw->randombit & 1);
+    }
+
+    random_state = mix32(entropy);
+    if (random_state == 0) {
+        random_state = 0x2545F491;
+    }
+}
+
+uint32_t hlc_random(void) {
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state = x;
+    return x;
+}
+
+// Uniform value in [0, bound) without a division
+uint32_t hlc_random_below(uint32_t bound) {
+    return (uint32_t)(((uint64_t)hlc_random() * bound) >> 32);
+}
@@ -0,0 +1,10 @@
+// Fast random numbers for the Halcyon modules
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+void hlc_random_seed(void);
+uint32_t hlc_random(void);
+uint32_t hlc_random_below(uint32_t bound);
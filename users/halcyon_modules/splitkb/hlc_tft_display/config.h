@@ -19,16 +19,48 @@
 #define LCD_OFFSET_X 52
 #define LCD_OFFSET_Y 40
 
+// Send the surface to the LCD with DMA in the background instead of blocking the
+// housekeeping pass, drawing waits until the previous frame has gone out
+#define LCD_ASYNC_FLUSH
+
+// Keep the framebuffer at 4 bits per pixel indexing a 16 color palette, expanded
+// to rgb565 while flushing (16KB instead of 64KB). Disable for a plain rgb565 surface.
+#define LCD_INDEXED_SURFACE
+// Rows expanded per flush chunk
+#define LCD_FLUSH_CHUNK_ROWS 8
+
 // QP Configuration
 #define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS TRUE
 #define ST7789_NO_AUTOMATIC_VIEWPORT_OFFSETS
 #define ST7789_NUM_DEVICES 1
 
+// The rgb565 surface when LCD_INDEXED_SURFACE is disabled
 #define SURFACE_NUM_DEVICES 1
 
 // Backlight configuration
 #undef BACKLIGHT_PIN
 #define BACKLIGHT_PIN GP27
 
-// Timeout configuration
-#define QUANTUM_PAINTER_DISPLAY_TIMEOUT HLC_BACKLIGHT_TIMEOUT
+// Animation frame interval on the shared time base (ms), stretched by the idle tier
+#define HLC_DISPLAY_FRAME_INTERVAL 100
+// Time a housekeeping pass may spend drawing and flushing before it yields to
+// the matrix scan, work left over continues in the next pass (us)
+#define HLC_DISPLAY_PASS_BUDGET_US 1000
+// A raw HID frame with no report for this long is given up and flushed as it is (ms)
+#define HLC_DISPLAY_HID_FRAME_TIMEOUT 500
+// Host content stays up this long after its last report, then its area is
+// cleared and the widgets under it come back (ms)
+#define HLC_DISPLAY_HID_HOLD 5000
+
+// WPM history band under the Game of Life (rules.mk HLC_WPM_HISTORY), its rows,
+// the time per line (ms, stretched by the idle tier) and the WPM of a full line
+#define HLC_WPM_HISTORY_HEIGHT 40
+#define HLC_WPM_HISTORY_INTERVAL 500
+#define HLC_WPM_HISTORY_MAX 150
+#ifdef HLC_WPM_HISTORY
+// The Game of Life runs on the slave half
+#    define SPLIT_WPM_ENABLE
+#endif
+
+// Timeout configuration, the idle tiers power the LCD instead
+#define QUANTUM_PAINTER_DISPLAY_TIMEOUT 0
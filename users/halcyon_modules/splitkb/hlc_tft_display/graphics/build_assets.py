@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+# Packs the layer numbers and lock labels of the Halcyon TFT display into hlc_assets.c
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Builds graphics/hlc_assets.c and graphics/hlc_assets.h.
+
+The display only ever draws the layer number images and three lock labels,
+in a normal and an underlined font. Instead of linking the full fonts and
+every number image, this script renders exactly those assets from the
+painter-convert outputs in fonts/ and numbers/ and packs them into a single
+1 bit per pixel atlas with a shared header.
+
+Each asset is stored either raw, a bit per pixel, or as run lengths per row,
+whichever the cost model below prefers. Run again after changing the
+manifest or one of the inputs:
+
+    python3 build_assets.py
+"""
+
+import re
+import sys
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+
+# (asset name, image) for the layer numbers, index is the layer, the last one
+# is shown for any higher layer
+IMAGES = [
+    ('LAYER_0', 'numbers/0.qgf.c'),
+    ('LAYER_1', 'numbers/1.qgf.c'),
+    ('LAYER_2', 'numbers/2.qgf.c'),
+    ('LAYER_3', 'numbers/3.qgf.c'),
+    ('LAYER_4', 'numbers/4.qgf.c'),
+    ('LAYER_5', 'numbers/5.qgf.c'),
+    ('LAYER_6', 'numbers/6.qgf.c'),
+    ('LAYER_7', 'numbers/7.qgf.c'),
+    ('LAYER_UNDEF', 'numbers/undef.qgf.c'),
+]
+
+FONT = 'fonts/Retron2000-27.qff.c'
+FONT_UNDERLINE = 'fonts/Retron2000-underline-27.qff.c'
+
+# (asset name, font, text) for the lock labels, off and on
+TEXTS = [
+    ('CAPS', FONT, 'Caps'),
+    ('CAPS_ON', FONT_UNDERLINE, 'Caps'),
+    ('NUM', FONT, 'Num'),
+    ('NUM_ON', FONT_UNDERLINE, 'Num'),
+    ('SCROLL', FONT, 'Scroll'),
+    ('SCROLL_ON', FONT_UNDERLINE, 'Scroll'),
+]
+
+# Estimated RP2040 cycles to decode into a framebuffer row, from the loops in
+# display_draw_asset_rows(): raw tests every pixel, run lengths fill spans
+RAW_CYCLES_PER_PIXEL = 6
+RLE_CYCLES_PER_RUN = 14
+RLE_CYCLES_PER_PIXEL = 3
+RLE_CYCLES_PER_SKIPPED_RUN = 4
+
+ENCODING_RAW = 0
+ENCODING_RLE = 1
+
+
+def read_c_array(path):
+    """Returns the bytes of the array in a painter-convert .c file."""
+    text = (HERE / path).read_text()
+    body = text[text.index('{', text.index('const uint8_t')):text.rindex('}')]
+    return bytes(int(value, 16) for value in re.findall(r'0x([0-9A-Fa-f]{2})', body))
+
+
+def read_blocks(data):
+    """Splits QGF and QFF data into {block type: payload}, first occurrence wins."""
+    blocks = {}
+    pos = 0
+    while pos < len(data):
+        type_id, negated = data[pos], data[pos + 1]
+        length = data[pos + 2] | data[pos + 3] << 8 | data[pos + 4] << 16
+        if type_id ^ negated != 0xFF:
+            raise ValueError(f'corrupt block header at {pos}')
+        blocks.setdefault(type_id, data[pos + 5:pos + 5 + length])
+        pos += 5 + length
+    return blocks
+
+
+def decode_qmk_rle(data, pos, length):
+    """Decodes Quantum Painter RLE from pos until length bytes are produced."""
+    out = bytearray()
+    while len(out) < length:
+        marker = data[pos]
+        pos += 1
+        if marker >= 128:
+            count = marker - 127
+            out += data[pos:pos + count]
+            pos += count
+        else:
+            out += bytes([data[pos]]) * marker
+            pos += 1
+    return bytes(out[:length])
+
+
+def unpack_mono(data, width, height, format_id, compression):
+    """Returns rows of 0/1 pixels from 1 bit per pixel data, LSB first."""
+    if format_id != 0:
+        raise ValueError('only mono2 (1 bit per pixel) assets are supported')
+    length = (width * height + 7) // 8
+    if compression == 1:
+        data = decode_qmk_rle(data, 0, length)
+    bits = [(data[i // 8] >> (i % 8)) & 1 for i in range(width * height)]
+    return [bits[y * width:(y + 1) * width] for y in range(height)]
+
+
+def load_image(path):
+    blocks = read_blocks(read_c_array(path))
+    descriptor, frame = blocks[0], blocks[2]
+    width = descriptor[12] | descriptor[13] << 8
+    height = descriptor[14] | descriptor[15] << 8
+    return unpack_mono(blocks[5], width, height, frame[0], frame[2])
+
+
+def render_text(path, text):
+    blocks = read_blocks(read_c_array(path))
+    descriptor, table, glyphs = blocks[0], blocks[1], blocks[4]
+    line_height = descriptor[12]
+    format_id, compression = descriptor[16], descriptor[18]
+    if format_id != 0:
+        raise ValueError(f'{path}: only mono2 fonts are supported')
+
+    rows = [[] for _ in range(line_height)]
+    for char in text:
+        index = (ord(char) - 0x20) * 3
+        entry = table[index] | table[index + 1] << 8 | table[index + 2] << 16
+        width, offset = entry & 0x3F, entry >> 6
+        length = (width * line_height + 7) // 8
+        if compression == 1:
+            data = decode_qmk_rle(glyphs, offset, length)
+        else:
+            data = glyphs[offset:offset + length]
+        glyph = unpack_mono(data, width, line_height, format_id, 0)
+        for y in range(line_height):
+            rows[y] += glyph[y]
+    return rows
+
+
+def trim(rows):
+    """Drops blank rows above and below, returns (rows, blank rows dropped above)."""
+    top = 0
+    while top < len(rows) - 1 and not any(rows[top]):
+        top += 1
+    bottom = len(rows)
+    while bottom > top + 1 and not any(rows[bottom - 1]):
+        bottom -= 1
+    return rows[top:bottom], top
+
+
+def encode_raw(rows):
+    out = bytearray()
+    for row in rows:
+        packed = bytearray((len(row) + 7) // 8)
+        for x, bit in enumerate(row):
+            packed[x // 8] |= bit << (x % 8)
+        out += packed
+    return bytes(out)
+
+
+def row_runs(row):
+    """Alternating background and foreground run lengths, starting with background."""
+    runs = []
+    value, length = 0, 0
+    for bit in row:
+        if bit != value:
+            runs.append(length)
+            value, length = bit, 0
+        length += 1
+    runs.append(length)
+    return runs
+
+
+def encode_rle(rows):
+    out = bytearray()
+    for row in rows:
+        for run in row_runs(row):
+            # Widths stay below 256, so a run always fits a byte
+            out.append(run)
+    return bytes(out)
+
+
+def decode_cost(rows, encoding):
+    """Estimated cycles to draw every row of the asset."""
+    pixels = sum(len(row) for row in rows)
+    if encoding == ENCODING_RAW:
+        return pixels * RAW_CYCLES_PER_PIXEL
+    runs = sum(len(row_runs(row)) for row in rows)
+    return runs * RLE_CYCLES_PER_RUN + pixels * RLE_CYCLES_PER_PIXEL
+
+
+def choose_encoding(rows):
+    """Run lengths when they are smaller and not slower to draw, raw otherwise."""
+    raw, rle = encode_raw(rows), encode_rle(rows)
+    if len(rle) < len(raw) and decode_cost(rows, ENCODING_RLE) <= decode_cost(rows, ENCODING_RAW):
+        return ENCODING_RLE, rle
+    return ENCODING_RAW, raw
+
+
+def c_bytes(data, indent='    '):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ' '.join(f'0x{b:02X},' for b in data[i:i + 16]))
+    return '\n'.join(lines)
+
+
+def main():
+    assets = [(name, load_image(path)) for name, path in IMAGES]
+    assets += [(name, render_text(font, text)) for name, font, text in TEXTS]
+
+    entries = []
+    data = bytearray()
+    inputs = set()
+    print(f'{"asset":<14}{"size":>9}{"raw":>7}{"rle":>7}{"raw cyc":>9}{"rle cyc":>9}  encoding')
+    for name, rows in assets:
+        rows, top = trim(rows)
+        width, height = len(rows[0]), len(rows)
+        if width > 255 or height > 255:
+            raise ValueError(f'{name}: assets are limited to 255x255')
+        encoding, encoded = choose_encoding(rows)
+        entries.append((name, width, height, top, encoding, len(data)))
+        data += encoded
+        print(f'{name:<14}{width:>4}x{height:<4}{len(encode_raw(rows)):>7}{len(encode_rle(rows)):>7}'
+              f'{decode_cost(rows, ENCODING_RAW):>9}{decode_cost(rows, ENCODING_RLE):>9}  '
+              f'{"rle" if encoding == ENCODING_RLE else "raw"}')
+
+    for _, path in IMAGES:
+        inputs.add(path)
+    for _, path, _ in TEXTS:
+        inputs.add(path)
+    original = sum(len(read_c_array(path)) for path in sorted(inputs))
+    print(f'atlas {len(data)} bytes of pixels, inputs {original} bytes')
+
+    header = HERE / 'hlc_assets.h'
+    source = HERE / 'hlc_assets.c'
+    generated = '// Generated by build_assets.py from fonts/ and numbers/, do not edit\n// SPDX-License-Identifier: GPL-2.0-or-later\n'
+
+    enum = '\n'.join(f'    HLC_ASSET_{name},' for name, *_ in entries)
+    sizes = '\n'.join(
+        f'#define HLC_ASSET_{name}_WIDTH {width}\n#define HLC_ASSET_{name}_HEIGHT {height}\n#define HLC_ASSET_{name}_TOP {top}'
+        for name, width, height, top, *_ in entries)
+    header.write_text(f'''{generated}
+#pragma once
+
+#include <stdint.h>
+
+#define HLC_ASSET_RAW 0 // A bit per pixel, rows padded to whole bytes, LSB first
+#define HLC_ASSET_RLE 1 // Per row, alternating background and foreground run lengths
+
+typedef struct {{
+    uint8_t  width;
+    uint8_t  height;
+    uint8_t  top;      // Blank rows trimmed above the asset
+    uint8_t  encoding;
+    uint16_t offset;   // Into hlc_asset_data
+}} hlc_asset_t;
+
+typedef enum {{
+{enum}
+    HLC_ASSET_COUNT
+}} hlc_asset_id_t;
+
+// Sizes as in hlc_assets, for layouts that are fixed at compile time
+{sizes}
+
+extern const hlc_asset_t hlc_assets[HLC_ASSET_COUNT];
+extern const uint8_t hlc_asset_data[{len(data)}];
+''')
+
+    table = '\n'.join(
+        f'    [HLC_ASSET_{name}] = {{ {width}, {height}, {top}, {"HLC_ASSET_RLE" if encoding == ENCODING_RLE else "HLC_ASSET_RAW"}, {offset} }},'
+        for name, width, height, top, encoding, offset in entries)
+    source.write_text(f'''{generated}
+#include "hlc_assets.h"
+
+const hlc_asset_t hlc_assets[HLC_ASSET_COUNT] = {{
+{table}
+}};
+
+const uint8_t hlc_asset_data[{len(data)}] = {{
+{c_bytes(data)}
+}};
+''')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
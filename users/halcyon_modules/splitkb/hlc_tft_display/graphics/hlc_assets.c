@@ -0,0 +1,277 @@
+// Generated by build_assets.py from fonts/ and numbers/, do not edit
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "hlc_assets.h"
+
+const hlc_asset_t hlc_assets[HLC_ASSET_COUNT] = {
+    [HLC_ASSET_LAYER_0] = { 75, 105, 0, HLC_ASSET_RLE, 0 },
+    [HLC_ASSET_LAYER_1] = { 75, 105, 0, HLC_ASSET_RLE, 420 },
+    [HLC_ASSET_LAYER_2] = { 75, 105, 0, HLC_ASSET_RLE, 750 },
+    [HLC_ASSET_LAYER_3] = { 75, 105, 0, HLC_ASSET_RLE, 1065 },
+    [HLC_ASSET_LAYER_4] = { 75, 105, 0, HLC_ASSET_RLE, 1380 },
+    [HLC_ASSET_LAYER_5] = { 75, 105, 0, HLC_ASSET_RLE, 1710 },
+    [HLC_ASSET_LAYER_6] = { 75, 105, 0, HLC_ASSET_RLE, 2010 },
+    [HLC_ASSET_LAYER_7] = { 75, 105, 0, HLC_ASSET_RLE, 2370 },
+    [HLC_ASSET_LAYER_UNDEF] = { 75, 15, 45, HLC_ASSET_RLE, 2670 },
+    [HLC_ASSET_CAPS] = { 72, 27, 3, HLC_ASSET_RLE, 2715 },
+    [HLC_ASSET_CAPS_ON] = { 72, 27, 3, HLC_ASSET_RLE, 2928 },
+    [HLC_ASSET_NUM] = { 54, 21, 3, HLC_ASSET_RAW, 3147 },
+    [HLC_ASSET_NUM_ON] = { 54, 25, 3, HLC_ASSET_RAW, 3294 },
+    [HLC_ASSET_SCROLL] = { 96, 21, 3, HLC_ASSET_RAW, 3469 },
+    [HLC_ASSET_SCROLL_ON] = { 96, 25, 3, HLC_ASSET_RLE, 3721 },
+};
+
+const uint8_t hlc_asset_data[4018] = {
+    0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0A,
+    0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x05, 0x41,
+    0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x00, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+    0x19, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23,
+    0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23,
+    0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x0F, 0x1E,
+    0x1E, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x0F, 0x1E, 0x1E, 0x00, 0x0F, 0x19,
+    0x23, 0x00, 0x0F, 0x19, 0x23, 0x00, 0x0F, 0x19, 0x23, 0x00, 0x0F, 0x19, 0x23, 0x00, 0x0F, 0x19,
+    0x23, 0x00, 0x0F, 0x14, 0x28, 0x00, 0x0F, 0x14, 0x28, 0x00, 0x0F, 0x14, 0x28, 0x00, 0x0F, 0x14,
+    0x28, 0x00, 0x0F, 0x14, 0x28, 0x00, 0x0F, 0x0F, 0x19, 0x05, 0x0F, 0x00, 0x0F, 0x0F, 0x19, 0x05,
+    0x0F, 0x00, 0x0F, 0x0F, 0x19, 0x05, 0x0F, 0x00, 0x0F, 0x0F, 0x19, 0x05, 0x0F, 0x00, 0x0F, 0x0F,
+    0x19, 0x05, 0x0F, 0x00, 0x0F, 0x0A, 0x19, 0x0A, 0x0F, 0x00, 0x0F, 0x0A, 0x19, 0x0A, 0x0F, 0x00,
+    0x0F, 0x0A, 0x19, 0x0A, 0x0F, 0x00, 0x0F, 0x0A, 0x19, 0x0A, 0x0F, 0x00, 0x0F, 0x0A, 0x19, 0x0A,
+    0x0F, 0x00, 0x0F, 0x05, 0x19, 0x0F, 0x0F, 0x00, 0x0F, 0x05, 0x19, 0x0F, 0x0F, 0x00, 0x0F, 0x05,
+    0x19, 0x0F, 0x0F, 0x00, 0x0F, 0x05, 0x19, 0x0F, 0x0F, 0x00, 0x0F, 0x05, 0x19, 0x0F, 0x0F, 0x00,
+    0x28, 0x14, 0x0F, 0x00, 0x28, 0x14, 0x0F, 0x00, 0x28, 0x14, 0x0F, 0x00, 0x28, 0x14, 0x0F, 0x00,
+    0x28, 0x14, 0x0F, 0x00, 0x23, 0x19, 0x0F, 0x00, 0x23, 0x19, 0x0F, 0x00, 0x23, 0x19, 0x0F, 0x00,
+    0x23, 0x19, 0x0F, 0x00, 0x23, 0x19, 0x0F, 0x00, 0x1E, 0x1E, 0x0F, 0x00, 0x1E, 0x1E, 0x0F, 0x00,
+    0x1E, 0x1E, 0x0F, 0x00, 0x1E, 0x1E, 0x0F, 0x00, 0x1E, 0x1E, 0x0F, 0x00, 0x19, 0x23, 0x0F, 0x00,
+    0x19, 0x23, 0x0F, 0x00, 0x19, 0x23, 0x0F, 0x00, 0x19, 0x23, 0x0F, 0x00, 0x19, 0x23, 0x0F, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05,
+    0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A,
+    0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0A, 0x23, 0x1E, 0x0A, 0x23, 0x1E, 0x0A, 0x23, 0x1E, 0x0A, 0x23, 0x1E, 0x0A,
+    0x23, 0x1E, 0x05, 0x28, 0x1E, 0x05, 0x28, 0x1E, 0x05, 0x28, 0x1E, 0x05, 0x28, 0x1E, 0x05, 0x28,
+    0x1E, 0x00, 0x19, 0x05, 0x0F, 0x1E, 0x00, 0x19, 0x05, 0x0F, 0x1E, 0x00, 0x19, 0x05, 0x0F, 0x1E,
+    0x00, 0x19, 0x05, 0x0F, 0x1E, 0x00, 0x19, 0x05, 0x0F, 0x1E, 0x00, 0x14, 0x0A, 0x0F, 0x1E, 0x00,
+    0x14, 0x0A, 0x0F, 0x1E, 0x00, 0x14, 0x0A, 0x0F, 0x1E, 0x00, 0x14, 0x0A, 0x0F, 0x1E, 0x00, 0x14,
+    0x0A, 0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x0F, 0x1E, 0x00, 0x0F, 0x0F,
+    0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0A, 0x37, 0x0A,
+    0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x05, 0x41, 0x05, 0x05,
+    0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x00, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C,
+    0x0F, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x32, 0x19, 0x32, 0x19, 0x32,
+    0x19, 0x32, 0x19, 0x32, 0x19, 0x0F, 0x37, 0x05, 0x0F, 0x37, 0x05, 0x0F, 0x37, 0x05, 0x0F, 0x37,
+    0x05, 0x0F, 0x37, 0x05, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A,
+    0x0A, 0x37, 0x0A, 0x05, 0x37, 0x0F, 0x05, 0x37, 0x0F, 0x05, 0x37, 0x0F, 0x05, 0x37, 0x0F, 0x05,
+    0x37, 0x0F, 0x00, 0x19, 0x32, 0x00, 0x19, 0x32, 0x00, 0x19, 0x32, 0x00, 0x19, 0x32, 0x00, 0x19,
+    0x32, 0x00, 0x14, 0x37, 0x00, 0x14, 0x37, 0x00, 0x14, 0x37, 0x00, 0x14, 0x37, 0x00, 0x14, 0x37,
+    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x4B, 0x00, 0x4B, 0x00,
+    0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00,
+    0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F,
+    0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37,
+    0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05,
+    0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14,
+    0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x0F,
+    0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F,
+    0x2D, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x37, 0x14, 0x37, 0x14,
+    0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19,
+    0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E,
+    0x23, 0x0A, 0x1E, 0x23, 0x0A, 0x1E, 0x23, 0x0A, 0x1E, 0x23, 0x0A, 0x1E, 0x23, 0x0A, 0x1E, 0x28,
+    0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x1E, 0x28, 0x05, 0x32, 0x19, 0x32,
+    0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37,
+    0x14, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05,
+    0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A,
+    0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F,
+    0x2D, 0x0F, 0x0F, 0x28, 0x14, 0x0F, 0x28, 0x14, 0x0F, 0x28, 0x14, 0x0F, 0x28, 0x14, 0x0F, 0x28,
+    0x14, 0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19,
+    0x0F, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x14,
+    0x19, 0x1E, 0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E, 0x0F, 0x19,
+    0x23, 0x0F, 0x19, 0x23, 0x0F, 0x19, 0x23, 0x0F, 0x19, 0x23, 0x0F, 0x19, 0x23, 0x0A, 0x19, 0x28,
+    0x0A, 0x19, 0x28, 0x0A, 0x19, 0x28, 0x0A, 0x19, 0x28, 0x0A, 0x19, 0x28, 0x05, 0x19, 0x2D, 0x05,
+    0x19, 0x2D, 0x05, 0x19, 0x2D, 0x05, 0x19, 0x2D, 0x05, 0x19, 0x2D, 0x00, 0x19, 0x14, 0x0F, 0x0F,
+    0x00, 0x19, 0x14, 0x0F, 0x0F, 0x00, 0x19, 0x14, 0x0F, 0x0F, 0x00, 0x19, 0x14, 0x0F, 0x0F, 0x00,
+    0x19, 0x14, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14,
+    0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19,
+    0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x14, 0x19, 0x0F,
+    0x0F, 0x00, 0x14, 0x19, 0x0F, 0x0F, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F,
+    0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F,
+    0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F,
+    0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x0F, 0x3C, 0x00,
+    0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F,
+    0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C,
+    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00,
+    0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F,
+    0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C,
+    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00,
+    0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x41,
+    0x0A, 0x00, 0x41, 0x0A, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05,
+    0x00, 0x46, 0x05, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x37, 0x14, 0x37,
+    0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C,
+    0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D,
+    0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23,
+    0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x05, 0x41, 0x05,
+    0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x0A, 0x37, 0x0A, 0x0A,
+    0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D,
+    0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F,
+    0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A,
+    0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41,
+    0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00,
+    0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x14, 0x23, 0x14, 0x00,
+    0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00,
+    0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00,
+    0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F,
+    0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C,
+    0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00,
+    0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x41, 0x0A, 0x00, 0x46,
+    0x05, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05, 0x00, 0x46, 0x05, 0x00, 0x0F, 0x23,
+    0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23, 0x19, 0x00, 0x0F, 0x23,
+    0x19, 0x00, 0x0F, 0x28, 0x14, 0x00, 0x0F, 0x28, 0x14, 0x00, 0x0F, 0x28, 0x14, 0x00, 0x0F, 0x28,
+    0x14, 0x00, 0x0F, 0x28, 0x14, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D,
+    0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D,
+    0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x14, 0x23,
+    0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23, 0x14, 0x00, 0x14, 0x23,
+    0x14, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41, 0x05, 0x05, 0x41,
+    0x05, 0x05, 0x41, 0x05, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A, 0x0A, 0x37, 0x0A,
+    0x0A, 0x37, 0x0A, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F, 0x2D, 0x0F, 0x0F,
+    0x2D, 0x0F, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x4B,
+    0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F,
+    0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F,
+    0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F,
+    0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x00, 0x0F, 0x2D, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F,
+    0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14, 0x37, 0x14,
+    0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x32, 0x19, 0x2D, 0x19, 0x05, 0x2D, 0x19, 0x05,
+    0x2D, 0x19, 0x05, 0x2D, 0x19, 0x05, 0x2D, 0x19, 0x05, 0x28, 0x19, 0x0A, 0x28, 0x19, 0x0A, 0x28,
+    0x19, 0x0A, 0x28, 0x19, 0x0A, 0x28, 0x19, 0x0A, 0x23, 0x19, 0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19,
+    0x0F, 0x23, 0x19, 0x0F, 0x23, 0x19, 0x0F, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14,
+    0x1E, 0x19, 0x14, 0x1E, 0x19, 0x14, 0x1E, 0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E,
+    0x14, 0x19, 0x1E, 0x14, 0x19, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F,
+    0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E,
+    0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E,
+    0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x1E, 0x0F, 0x1E, 0x07, 0x3D,
+    0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07,
+    0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07,
+    0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x07, 0x3D, 0x07, 0x05, 0x09, 0x3A, 0x04, 0x0B,
+    0x39, 0x03, 0x0D, 0x38, 0x02, 0x05, 0x05, 0x05, 0x37, 0x02, 0x04, 0x07, 0x04, 0x37, 0x02, 0x03,
+    0x09, 0x03, 0x37, 0x02, 0x03, 0x12, 0x09, 0x06, 0x03, 0x03, 0x06, 0x09, 0x0C, 0x01, 0x02, 0x03,
+    0x12, 0x0A, 0x05, 0x03, 0x02, 0x08, 0x07, 0x0D, 0x01, 0x02, 0x03, 0x12, 0x0B, 0x04, 0x03, 0x01,
+    0x0A, 0x05, 0x0E, 0x01, 0x02, 0x03, 0x19, 0x05, 0x03, 0x08, 0x02, 0x05, 0x03, 0x05, 0x0B, 0x02,
+    0x03, 0x1A, 0x04, 0x03, 0x07, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x02, 0x03, 0x1B, 0x03, 0x03, 0x06,
+    0x06, 0x03, 0x03, 0x05, 0x0B, 0x02, 0x03, 0x12, 0x0C, 0x03, 0x05, 0x07, 0x03, 0x04, 0x0B, 0x04,
+    0x02, 0x03, 0x11, 0x0D, 0x03, 0x04, 0x08, 0x03, 0x05, 0x0B, 0x03, 0x02, 0x03, 0x10, 0x0E, 0x03,
+    0x03, 0x09, 0x03, 0x06, 0x0B, 0x02, 0x02, 0x03, 0x09, 0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03,
+    0x09, 0x03, 0x0D, 0x05, 0x01, 0x02, 0x04, 0x07, 0x04, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x08,
+    0x04, 0x0E, 0x04, 0x01, 0x02, 0x05, 0x05, 0x05, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x07, 0x05,
+    0x0D, 0x05, 0x01, 0x03, 0x0D, 0x05, 0x0E, 0x03, 0x0E, 0x04, 0x0E, 0x02, 0x04, 0x0B, 0x07, 0x0D,
+    0x03, 0x0D, 0x05, 0x0D, 0x03, 0x05, 0x09, 0x09, 0x0C, 0x03, 0x0C, 0x06, 0x0C, 0x04, 0x26, 0x03,
+    0x1F, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F,
+    0x05, 0x09, 0x3A, 0x04, 0x0B, 0x39, 0x03, 0x0D, 0x38, 0x02, 0x05, 0x05, 0x05, 0x37, 0x02, 0x04,
+    0x07, 0x04, 0x37, 0x02, 0x03, 0x09, 0x03, 0x37, 0x02, 0x03, 0x12, 0x09, 0x06, 0x03, 0x03, 0x06,
+    0x09, 0x0C, 0x01, 0x02, 0x03, 0x12, 0x0A, 0x05, 0x03, 0x02, 0x08, 0x07, 0x0D, 0x01, 0x02, 0x03,
+    0x12, 0x0B, 0x04, 0x03, 0x01, 0x0A, 0x05, 0x0E, 0x01, 0x02, 0x03, 0x19, 0x05, 0x03, 0x08, 0x02,
+    0x05, 0x03, 0x05, 0x0B, 0x02, 0x03, 0x1A, 0x04, 0x03, 0x07, 0x04, 0x04, 0x03, 0x04, 0x0C, 0x02,
+    0x03, 0x1B, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x05, 0x0B, 0x02, 0x03, 0x12, 0x0C, 0x03, 0x05,
+    0x07, 0x03, 0x04, 0x0B, 0x04, 0x02, 0x03, 0x11, 0x0D, 0x03, 0x04, 0x08, 0x03, 0x05, 0x0B, 0x03,
+    0x02, 0x03, 0x10, 0x0E, 0x03, 0x03, 0x09, 0x03, 0x06, 0x0B, 0x02, 0x02, 0x03, 0x09, 0x03, 0x03,
+    0x05, 0x07, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0D, 0x05, 0x01, 0x02, 0x04, 0x07, 0x04, 0x03, 0x04,
+    0x08, 0x03, 0x03, 0x03, 0x08, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x05, 0x05, 0x05, 0x03, 0x05, 0x07,
+    0x03, 0x03, 0x03, 0x07, 0x05, 0x0D, 0x05, 0x01, 0x03, 0x0D, 0x05, 0x0E, 0x03, 0x0E, 0x04, 0x0E,
+    0x02, 0x04, 0x0B, 0x07, 0x0D, 0x03, 0x0D, 0x05, 0x0D, 0x03, 0x05, 0x09, 0x09, 0x0C, 0x03, 0x0C,
+    0x06, 0x0C, 0x04, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F, 0x00, 0x25, 0x01, 0x03, 0x01, 0x1E, 0x00,
+    0x25, 0x01, 0x03, 0x01, 0x1E, 0x26, 0x03, 0x1F, 0x26, 0x03, 0x1F, 0x1C, 0xC0, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xC3,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xC7, 0x71, 0x00, 0xC7, 0x8F, 0x03, 0x9C, 0xCF, 0x71, 0x00,
+    0xC7, 0xDF, 0x07, 0x1C, 0xDF, 0x71, 0x00, 0xC7, 0xFF, 0x0F, 0x1C, 0xFE, 0x71, 0x00, 0xC7, 0xFF,
+    0x1F, 0x1C, 0xFC, 0x71, 0x00, 0xC7, 0xFB, 0x1E, 0x1C, 0xF8, 0x71, 0x00, 0xC7, 0x71, 0x1C, 0x1C,
+    0xF0, 0x71, 0x00, 0xC7, 0x71, 0x1C, 0x1C, 0xE0, 0x71, 0x80, 0xC7, 0x71, 0x1C, 0x1C, 0xC0, 0x71,
+    0xC0, 0xC7, 0x71, 0x1C, 0x1C, 0xC0, 0x71, 0xE0, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0xF1, 0xF0, 0xC7,
+    0x01, 0x1C, 0x1C, 0xC0, 0xF1, 0xF9, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0xE1, 0x7F, 0xC7, 0x01, 0x1C,
+    0x1C, 0xC0, 0xC1, 0x3F, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0x81, 0x1F, 0xC7, 0x01, 0x1C, 0x1C, 0xC0,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC0, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xC1, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xC3, 0x01, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xC7, 0x71, 0x00, 0xC7, 0x8F, 0x03, 0x9C,
+    0xCF, 0x71, 0x00, 0xC7, 0xDF, 0x07, 0x1C, 0xDF, 0x71, 0x00, 0xC7, 0xFF, 0x0F, 0x1C, 0xFE, 0x71,
+    0x00, 0xC7, 0xFF, 0x1F, 0x1C, 0xFC, 0x71, 0x00, 0xC7, 0xFB, 0x1E, 0x1C, 0xF8, 0x71, 0x00, 0xC7,
+    0x71, 0x1C, 0x1C, 0xF0, 0x71, 0x00, 0xC7, 0x71, 0x1C, 0x1C, 0xE0, 0x71, 0x80, 0xC7, 0x71, 0x1C,
+    0x1C, 0xC0, 0x71, 0xC0, 0xC7, 0x71, 0x1C, 0x1C, 0xC0, 0x71, 0xE0, 0xC7, 0x01, 0x1C, 0x1C, 0xC0,
+    0xF1, 0xF0, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0xF1, 0xF9, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0xE1, 0x7F,
+    0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0xC1, 0x3F, 0xC7, 0x01, 0x1C, 0x1C, 0xC0, 0x81, 0x1F, 0xC7, 0x01,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE0, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xC0, 0x01, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0,
+    0x01, 0x7C, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x3C, 0xE0, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xC0, 0x01, 0x1C, 0x00, 0x80, 0xFF, 0xC0, 0xF1, 0x03, 0xF8, 0x0F, 0x1C, 0xC0,
+    0x01, 0x3C, 0x00, 0xC0, 0xFF, 0xC1, 0xF9, 0x07, 0xFC, 0x1F, 0x1C, 0xC0, 0x01, 0x7C, 0x00, 0xE0,
+    0xFF, 0xC3, 0xFD, 0x0F, 0xFE, 0x3F, 0x1C, 0xC0, 0x01, 0xF8, 0x3F, 0xF0, 0xC1, 0xC7, 0x3F, 0x1F,
+    0x1F, 0x7C, 0x1C, 0xC0, 0x01, 0xF0, 0x7F, 0xF0, 0x80, 0xC7, 0x1F, 0x1E, 0x0F, 0x78, 0x1C, 0xC0,
+    0x01, 0xE0, 0xFF, 0x70, 0x00, 0xC7, 0x0F, 0x1C, 0x07, 0x70, 0x1C, 0xC0, 0x01, 0x00, 0xF0, 0x71,
+    0x00, 0xC0, 0x07, 0x00, 0x07, 0x70, 0x1C, 0xC0, 0x01, 0x00, 0xE0, 0x71, 0x00, 0xC0, 0x03, 0x00,
+    0x07, 0x70, 0x1C, 0xC0, 0x01, 0x00, 0xC0, 0x71, 0x00, 0xC0, 0x01, 0x00, 0x07, 0x70, 0x1C, 0xC0,
+    0x01, 0x1C, 0xC0, 0x71, 0x00, 0xC7, 0x01, 0x00, 0x07, 0x70, 0x1C, 0xC0, 0x01, 0x3C, 0xE0, 0xF1,
+    0x80, 0xC7, 0x01, 0x00, 0x0F, 0x78, 0x3C, 0xC0, 0x03, 0x7C, 0xF0, 0xF1, 0xC1, 0xC7, 0x01, 0x00,
+    0x1F, 0x7C, 0x7C, 0xC0, 0x07, 0xF8, 0xFF, 0xE0, 0xFF, 0xC3, 0x01, 0x00, 0xFE, 0x3F, 0xF8, 0x87,
+    0x7F, 0xF0, 0x7F, 0xC0, 0xFF, 0xC1, 0x01, 0x00, 0xFC, 0x1F, 0xF0, 0x07, 0x7F, 0xE0, 0x3F, 0x80,
+    0xFF, 0xC0, 0x01, 0x00, 0xF8, 0x0F, 0xE0, 0x07, 0x7E, 0x05, 0x09, 0x3C, 0x03, 0x09, 0x03, 0x07,
+    0x04, 0x0B, 0x3B, 0x03, 0x09, 0x03, 0x07, 0x03, 0x0D, 0x3A, 0x03, 0x09, 0x03, 0x07, 0x02, 0x05,
+    0x05, 0x05, 0x39, 0x03, 0x09, 0x03, 0x07, 0x02, 0x04, 0x07, 0x04, 0x39, 0x03, 0x09, 0x03, 0x07,
+    0x02, 0x03, 0x09, 0x03, 0x39, 0x03, 0x09, 0x03, 0x07, 0x02, 0x03, 0x12, 0x09, 0x06, 0x03, 0x03,
+    0x06, 0x09, 0x09, 0x06, 0x03, 0x09, 0x03, 0x07, 0x02, 0x04, 0x10, 0x0B, 0x05, 0x03, 0x02, 0x08,
+    0x07, 0x0B, 0x05, 0x03, 0x09, 0x03, 0x07, 0x02, 0x05, 0x0E, 0x0D, 0x04, 0x03, 0x01, 0x0A, 0x05,
+    0x0D, 0x04, 0x03, 0x09, 0x03, 0x07, 0x03, 0x0B, 0x06, 0x05, 0x05, 0x05, 0x03, 0x08, 0x02, 0x05,
+    0x03, 0x05, 0x05, 0x05, 0x03, 0x03, 0x09, 0x03, 0x07, 0x04, 0x0B, 0x05, 0x04, 0x07, 0x04, 0x03,
+    0x07, 0x04, 0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x07, 0x05, 0x0B, 0x04, 0x03,
+    0x09, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x07, 0x0C,
+    0x05, 0x03, 0x03, 0x0F, 0x05, 0x0D, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x07, 0x0D, 0x04,
+    0x03, 0x03, 0x0F, 0x04, 0x0E, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x07, 0x0E, 0x03, 0x03,
+    0x03, 0x0F, 0x03, 0x0F, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x07, 0x02, 0x03, 0x09, 0x03,
+    0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0F, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x07, 0x02,
+    0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x0F, 0x04, 0x07, 0x04, 0x03, 0x04, 0x08,
+    0x04, 0x06, 0x02, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x03, 0x0F, 0x05, 0x05, 0x05,
+    0x03, 0x05, 0x07, 0x05, 0x05, 0x03, 0x0D, 0x05, 0x0D, 0x04, 0x03, 0x10, 0x0D, 0x05, 0x08, 0x04,
+    0x08, 0x01, 0x04, 0x0B, 0x07, 0x0B, 0x05, 0x03, 0x11, 0x0B, 0x07, 0x07, 0x05, 0x07, 0x01, 0x05,
+    0x09, 0x09, 0x09, 0x06, 0x03, 0x12, 0x09, 0x09, 0x06, 0x06, 0x06, 0x01, 0x60, 0x60, 0x00, 0x60,
+    0x00, 0x60,
+};
@@ -0,0 +1,86 @@
+// Generated by build_assets.py from fonts/ and numbers/, do not edit
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#define HLC_ASSET_RAW 0 // A bit per pixel, rows padded to whole bytes, LSB first
+#define HLC_ASSET_RLE 1 // Per row, alternating background and foreground run lengths
+
+typedef struct {
+    uint8_t  width;
+    uint8_t  height;
+    uint8_t  top;      // Blank rows trimmed above the asset
+    uint8_t  encoding;
+    uint16_t offset;   // Into hlc_asset_data
+} hlc_asset_t;
+
+typedef enum {
+    HLC_ASSET_LAYER_0,
+    HLC_ASSET_LAYER_1,
+    HLC_ASSET_LAYER_2,
+    HLC_ASSET_LAYER_3,
+    HLC_ASSET_LAYER_4,
+    HLC_ASSET_LAYER_5,
+    HLC_ASSET_LAYER_6,
+    HLC_ASSET_LAYER_7,
+    HLC_ASSET_LAYER_UNDEF,
+    HLC_ASSET_CAPS,
+    HLC_ASSET_CAPS_ON,
+    HLC_ASSET_NUM,
+    HLC_ASSET_NUM_ON,
+    HLC_ASSET_SCROLL,
+    HLC_ASSET_SCROLL_ON,
+    HLC_ASSET_COUNT
+} hlc_asset_id_t;
+
+// Sizes as in hlc_assets, for layouts that are fixed at compile time
+#define HLC_ASSET_LAYER_0_WIDTH 75
+#define HLC_ASSET_LAYER_0_HEIGHT 105
+#define HLC_ASSET_LAYER_0_TOP 0
+#define HLC_ASSET_LAYER_1_WIDTH 75
+#define HLC_ASSET_LAYER_1_HEIGHT 105
+#define HLC_ASSET_LAYER_1_TOP 0
+#define HLC_ASSET_LAYER_2_WIDTH 75
+#define HLC_ASSET_LAYER_2_HEIGHT 105
+#define HLC_ASSET_LAYER_2_TOP 0
+#define HLC_ASSET_LAYER_3_WIDTH 75
+#define HLC_ASSET_LAYER_3_HEIGHT 105
+#define HLC_ASSET_LAYER_3_TOP 0
+#define HLC_ASSET_LAYER_4_WIDTH 75
+#define HLC_ASSET_LAYER_4_HEIGHT 105
+#define HLC_ASSET_LAYER_4_TOP 0
+#define HLC_ASSET_LAYER_5_WIDTH 75
+#define HLC_ASSET_LAYER_5_HEIGHT 105
+#define HLC_ASSET_LAYER_5_TOP 0
+#define HLC_ASSET_LAYER_6_WIDTH 75
+#define HLC_ASSET_LAYER_6_HEIGHT 105
+#define HLC_ASSET_LAYER_6_TOP 0
+#define HLC_ASSET_LAYER_7_WIDTH 75
+#define HLC_ASSET_LAYER_7_HEIGHT 105
+#define HLC_ASSET_LAYER_7_TOP 0
+#define HLC_ASSET_LAYER_UNDEF_WIDTH 75
+#define HLC_ASSET_LAYER_UNDEF_HEIGHT 15
+#define HLC_ASSET_LAYER_UNDEF_TOP 45
+#define HLC_ASSET_CAPS_WIDTH 72
+#define HLC_ASSET_CAPS_HEIGHT 27
+#define HLC_ASSET_CAPS_TOP 3
+#define HLC_ASSET_CAPS_ON_WIDTH 72
+#define HLC_ASSET_CAPS_ON_HEIGHT 27
+#define HLC_ASSET_CAPS_ON_TOP 3
+#define HLC_ASSET_NUM_WIDTH 54
+#define HLC_ASSET_NUM_HEIGHT 21
+#define HLC_ASSET_NUM_TOP 3
+#define HLC_ASSET_NUM_ON_WIDTH 54
+#define HLC_ASSET_NUM_ON_HEIGHT 25
+#define HLC_ASSET_NUM_ON_TOP 3
+#define HLC_ASSET_SCROLL_WIDTH 96
+#define HLC_ASSET_SCROLL_HEIGHT 21
+#define HLC_ASSET_SCROLL_TOP 3
+#define HLC_ASSET_SCROLL_ON_WIDTH 96
+#define HLC_ASSET_SCROLL_ON_HEIGHT 25
+#define HLC_ASSET_SCROLL_ON_TOP 3
+
+extern const hlc_asset_t hlc_assets[HLC_ASSET_COUNT];
+extern const uint8_t hlc_asset_data[4018];
@@ -3,312 +3,558 @@
 
 #include "halcyon.h"
 #include "hlc_tft_display.h"
+#include "hlc_random.h"
+#include "hlc_idle.h"
+#include "hlc_tft_widgets.h"
+#ifdef HLC_PERF_OVERLAY
+#    include "hlc_tft_overlay.h"
+#endif
+
+typedef enum {
+    LOCK_CAPS,
+    LOCK_NUM,
+    LOCK_SCROLL,
+    LOCK_COUNT
+} lock_label_t;
+
+// Lock indicator labels, top to bottom, off and on, and their colors
+static const hlc_asset_id_t lock_assets[LOCK_COUNT][2] = {
+    [LOCK_CAPS]   = { HLC_ASSET_CAPS,   HLC_ASSET_CAPS_ON },
+    [LOCK_NUM]    = { HLC_ASSET_NUM,    HLC_ASSET_NUM_ON },
+    [LOCK_SCROLL] = { HLC_ASSET_SCROLL, HLC_ASSET_SCROLL_ON },
+};
+static const uint8_t lock_colors[LOCK_COUNT][2][3] = {
+    [LOCK_CAPS]   = { { HSV_CAPS_OFF },   { HSV_CAPS_ON } },
+    [LOCK_NUM]    = { { HSV_NUM_OFF },    { HSV_NUM_ON } },
+    [LOCK_SCROLL] = { { HSV_SCROLL_OFF }, { HSV_SCROLL_ON } },
+};
+
+// Lock labels are stacked at the bottom, each in a box that fits its off and on
+// asset, including the blank rows trimmed above them. The stack is spaced by the tallest.
+#define LOCK_ASSET_BOTTOM(name) (HLC_ASSET_##name##_TOP + HLC_ASSET_##name##_HEIGHT)
+#define LOCK_BOX_WIDTH(name) MAX(HLC_ASSET_##name##_WIDTH, HLC_ASSET_##name##_ON_WIDTH)
+#define LOCK_BOX_HEIGHT(name) MAX(LOCK_ASSET_BOTTOM(name), LOCK_ASSET_BOTTOM(name##_ON))
+#define LOCK_LABEL_HEIGHT MAX(LOCK_BOX_HEIGHT(CAPS), MAX(LOCK_BOX_HEIGHT(NUM), LOCK_BOX_HEIGHT(SCROLL)))
+#define LOCK_LABEL_Y(lock) (LCD_HEIGHT - (LOCK_LABEL_HEIGHT + 5) * (LOCK_COUNT - (lock)))
+
+// Layer colors, also used for the alive cells (indexed by color_value)
+static const uint8_t layer_palette[][3] = {
+    { HSV_LAYER_0 }, { HSV_LAYER_1 }, { HSV_LAYER_2 }, { HSV_LAYER_3 },
+    { HSV_LAYER_4 }, { HSV_LAYER_5 }, { HSV_LAYER_6 }, { HSV_LAYER_7 },
+    { HSV_LAYER_UNDEF },
+};
+#define LAYER_PALETTE_SIZE (sizeof(layer_palette) / sizeof(layer_palette[0]))
+
+// Layer number images, drawn in their layer color, the last one is drawn for any higher layer
+static const hlc_asset_id_t layer_assets[LAYER_PALETTE_SIZE] = {
+    HLC_ASSET_LAYER_0, HLC_ASSET_LAYER_1, HLC_ASSET_LAYER_2, HLC_ASSET_LAYER_3,
+    HLC_ASSET_LAYER_4, HLC_ASSET_LAYER_5, HLC_ASSET_LAYER_6, HLC_ASSET_LAYER_7,
+    HLC_ASSET_LAYER_UNDEF,
+};
 
-#include "hardware/structs/rosc.h"
+int color_value = 0;
 
-// Fonts mono2
-#include "graphics/fonts/Retron2000-27.qff.h"
-#include "graphics/fonts/Retron2000-underline-27.qff.h"
+// Render scheduler: drawing and flushing are split into small steps, and a
+// housekeeping pass stops taking steps once its budget is used up
+static uint32_t pass_start = 0;
 
-// Numbers mono2
-#include "graphics/numbers/0.qgf.h"
-#include "graphics/numbers/1.qgf.h"
-#include "graphics/numbers/2.qgf.h"
-#include "graphics/numbers/3.qgf.h"
-#include "graphics/numbers/4.qgf.h"
-#include "graphics/numbers/5.qgf.h"
-#include "graphics/numbers/6.qgf.h"
-#include "graphics/numbers/7.qgf.h"
-#include "graphics/numbers/8.qgf.h"
-#include "graphics/numbers/9.qgf.h"
-#include "graphics/numbers/undef.qgf.h"
+// Master display widgets with a redraw still in progress
+static bool widgets_pending = false;
 
-static const char *caps =        "Caps";
-static const char *num =         "Num";
-static const char *scroll =      "Scroll";
+// Animation rate and LCD power of the current idle tier
+static uint8_t animation_divider = 1;
+static bool lcd_on = true;
+static bool lcd_powered = true; // Follows lcd_on once the frame being sent is out
 
-static painter_font_handle_t Retron27;
-static painter_font_handle_t Retron27_underline;
-static painter_image_handle_t layer_number;
+// Raw HID frame between BEGIN and END, flushed only once complete
+static bool host_frame_open = false;
+static uint32_t host_frame_report = 0;
 
-static uint8_t lcd_surface_fb[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(135, 240, 16)];
+// Screen area the host drew into, the widgets under it stay hidden while it is shown
+static bool host_area_shown = false;
+static uint16_t host_area_left, host_area_top, host_area_right, host_area_bottom;
 
-int color_value = 0;
+// Game of Life generation being drawn, a grid row per step
+static bool life_drawing = false;
+static uint8_t life_row = 0;
 
 painter_device_t lcd;
-painter_device_t lcd_surface;
 
-led_t last_led_usb_state = {0};
-layer_state_t last_layer_state = {0};
+
+#ifdef HLC_WPM_HISTORY
+// The WPM history band takes the bottom rows, the grid the ones above it
+#    define LIFE_HEIGHT (LCD_HEIGHT - HLC_WPM_HISTORY_HEIGHT)
+#else
+#    define LIFE_HEIGHT LCD_HEIGHT
+#endif
 
 #define GRID_WIDTH 27
-#define GRID_HEIGHT 48
 #define CELL_SIZE 4  // Cell size excluding outline
 #define OUTLINE_SIZE 1
+#define CELL_PITCH (CELL_SIZE + OUTLINE_SIZE)
+#define GRID_HEIGHT (LIFE_HEIGHT / CELL_PITCH)
+
 
 // Define the probability factor for initial alive cells
 #define INITIAL_ALIVE_PROBABILITY 0.2  // 20% chance of being alive
 
-bool grid[GRID_HEIGHT][GRID_WIDTH];  // Current state
-bool new_grid[GRID_HEIGHT][GRID_WIDTH];  // Next state
-bool changed_grid[GRID_HEIGHT][GRID_WIDTH]; // Tracks changed cells
+// One row per word, bit x is the cell in column x
+#define GRID_ROW_MASK ((1UL << GRID_WIDTH) - 1)
+#define CELL_ALIVE(row, x) (((row) >> (x)) & 1)
 
-uint32_t get_random_32bit(void) {
-    uint32_t random_value = 0;
-    for (int i = 0; i < 32; i++) {
-        wait_ms(1);
-        random_value = (random_value << 1) | (rosc_hw->randombit & 1);
-    }
-    return random_value;
-}
+static uint32_t grid_a[GRID_HEIGHT];
+static uint32_t grid_b[GRID_HEIGHT];
+static uint32_t *grid = grid_a;      // Current state
+static uint32_t *new_grid = grid_b;  // Next state
+static uint32_t changed_grid[GRID_HEIGHT]; // Tracks changed cells
 
 void init_grid() {
     // Initialize grid with alive cells
     for (int y = 0; y < GRID_HEIGHT; y++) {
+        uint32_t row = 0;
         for (int x = 0; x < GRID_WIDTH; x++) {
-            grid[y][x] = (rand() < INITIAL_ALIVE_PROBABILITY * RAND_MAX);  // Use probability factor
-            changed_grid[y][x] = true;      // Mark all as changed initially
+            if (hlc_random() < (uint32_t)(INITIAL_ALIVE_PROBABILITY * UINT32_MAX)) {  // Use probability factor
+                row |= 1UL << x;
+            }
         }
+        grid[y] = row;
+        changed_grid[y] = GRID_ROW_MASK;  // Mark all as changed initially
     }
 }
 
-void draw_grid() {
-    uint8_t hue = 0;  // Hue for alive cells
-    uint8_t sat = 0;  // Saturation for alive cells
-    uint8_t val_dead = 0;  // Brightness for dead cells
+// Draws a run of adjacent cells of one grid row
+static void draw_cell_span(int y, int x_start, int x_end, display_color_t color) {
+    display_color_t line[LCD_WIDTH];
+
+    uint16_t left = x_start * CELL_PITCH;
+    uint16_t top = y * CELL_PITCH;
+    uint16_t right = x_end * CELL_PITCH + CELL_PITCH;
+    uint16_t bottom = top + CELL_PITCH; // Outline row below, the top outline of the next grid row
+    if (right >= LCD_WIDTH) right = LCD_WIDTH - 1;
+    uint16_t width = right - left + 1;
+    // The last grid row has no outline below it when it ends at the edge
+    uint16_t interior_end = MIN(bottom, LIFE_HEIGHT);
+
+    // Outline rows above and below the run
+    display_fill_rect(left, top, right, top + OUTLINE_SIZE - 1, DISPLAY_COLOR_BLACK);
+    if (bottom < LIFE_HEIGHT) {
+        display_fill_rect(left, bottom, right, bottom, DISPLAY_COLOR_BLACK);
+    }
+    if (color == DISPLAY_COLOR_BLACK) {
+        display_fill_rect(left, top + OUTLINE_SIZE, right, interior_end - 1, DISPLAY_COLOR_BLACK);
+        return;
+    }
 
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            if (changed_grid[y][x]) { // Only update changed cells
-                uint16_t left = x * (CELL_SIZE + OUTLINE_SIZE);
-                uint16_t top = y * (CELL_SIZE + OUTLINE_SIZE);
-                uint16_t right = left + CELL_SIZE + OUTLINE_SIZE;
-                uint16_t bottom = top + CELL_SIZE + OUTLINE_SIZE;
-
-                // Draw the outline
-                qp_rect(lcd_surface, left, top, right, bottom, hue, sat, val_dead, true);
-
-                // Draw the filled cell inside the outline if it's alive
-                if (grid[y][x]) {
-                    switch (color_value) {
-                    case 0:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_0, true);
-                        break;
-                    case 1:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_1, true);
-                        break;
-                    case 2:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_2, true);
-                        break;
-                    case 3:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_3, true);
-                        break;
-                    case 4:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_4, true);
-                        break;
-                    case 5:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_5, true);
-                        break;
-                    case 6:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_6, true);
-                        break;
-                    case 7:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_7, true);
-                        break;
-                    default:
-                        qp_rect(lcd_surface, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE, bottom - OUTLINE_SIZE, HSV_LAYER_UNDEF, true);
-                    }
-                }
-            }
-        }
+    // Interior pixel row: outline, fill, outline, fill, ...
+    for (uint16_t i = 0; i < width; i++) {
+        line[i] = (i % CELL_PITCH) < OUTLINE_SIZE ? DISPLAY_COLOR_BLACK : color;
+    }
+    for (uint16_t py = top + OUTLINE_SIZE; py < interior_end; py++) {
+        display_write_row(left, py, line, width);
     }
 }
 
-void update_grid() {
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            int alive_neighbors = 0;
-
-            // Count alive neighbors
-            for (int dy = -1; dy <= 1; dy++) {
-                for (int dx = -1; dx <= 1; dx++) {
-                    if (dy == 0 && dx == 0) continue;  // Skip the current cell
-                    int ny = y + dy;
-                    int nx = x + dx;
-                    if (ny >= 0 && ny < GRID_HEIGHT && nx >= 0 && nx < GRID_WIDTH) {
-                        alive_neighbors += grid[ny][nx];
-                    }
-                }
-            }
+// Color of the alive cells, picked from the layer colors
+static display_color_t life_color(void) {
+    uint8_t palette_index = (unsigned)color_value < LAYER_PALETTE_SIZE ? (unsigned)color_value : LAYER_PALETTE_SIZE - 1;
+    return display_color(layer_palette[palette_index][0], layer_palette[palette_index][1], layer_palette[palette_index][2]);
+}
 
-            // Apply the rules of the Game of Life
-            if (grid[y][x]) {
-                // Any live cell with two or three live neighbours survives.
-                new_grid[y][x] = (alive_neighbors == 2 || alive_neighbors == 3);
-            } else {
-                // Any dead cell with exactly three live neighbours becomes a live cell.
-                new_grid[y][x] = (alive_neighbors == 3);
-            }
+static void draw_grid_row(int y) {
+    display_color_t alive_color = life_color();
+    uint32_t changed = changed_grid[y];
 
-            // Track changed cells
-            changed_grid[y][x] = (grid[y][x] != new_grid[y][x]);
-        }
+    while (changed) { // Only update changed cells
+        int x = __builtin_ctz(changed);
+        bool alive = CELL_ALIVE(grid[y], x);
+
+        // Extend the run over adjacent changed cells with the same state
+        uint32_t same = changed & (alive ? grid[y] : ~grid[y]);
+        int run = __builtin_ctz(~(same >> x));
+        changed &= ~(((1UL << run) - 1) << x);
+
+        draw_cell_span(y, x, x + run - 1, alive ? alive_color : DISPLAY_COLOR_BLACK);
     }
+}
+
+// Adds three neighbour masks per bit, giving a two bit count
+static inline void add3(uint32_t a, uint32_t b, uint32_t c, uint32_t *ones, uint32_t *twos) {
+    uint32_t t = a ^ b;
+    *ones = t ^ c;
+    *twos = (a & b) | (t & c);
+}
 
-    // Copy new grid state to current grid
+void update_grid() {
     for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            grid[y][x] = new_grid[y][x];
-        }
+        uint32_t above = y > 0 ? grid[y - 1] : 0;
+        uint32_t row = grid[y];
+        uint32_t below = y < GRID_HEIGHT - 1 ? grid[y + 1] : 0;
+
+        // Count alive neighbors for all 27 cells at once with bit-sliced adders
+        uint32_t a0, a1, b0, b1, t0, t1, k1;
+        add3((above << 1) & GRID_ROW_MASK, above, above >> 1, &a0, &a1);
+        add3((below << 1) & GRID_ROW_MASK, below, below >> 1, &b0, &b1);
+        uint32_t c0 = ((row << 1) & GRID_ROW_MASK) ^ (row >> 1);
+        uint32_t c1 = ((row << 1) & GRID_ROW_MASK) & (row >> 1);
+
+        uint32_t s0;
+        add3(a0, b0, c0, &s0, &k1);   // Ones bit, carry into twos
+        add3(a1, b1, c1, &t0, &t1);   // Twos column
+        uint32_t s1 = t0 ^ k1;
+        uint32_t s2 = t1 ^ (t0 & k1); // Fours bit, a count of 8 wraps to 0 and dies anyway
+
+        // Any live cell with two or three live neighbours survives.
+        // Any dead cell with exactly three live neighbours becomes a live cell.
+        new_grid[y] = s1 & ~s2 & (s0 | row);
+
+        // Track changed cells
+        changed_grid[y] = row ^ new_grid[y];
     }
+
+    // Swap buffers, the new state becomes current
+    uint32_t *swap = grid;
+    grid = new_grid;
+    new_grid = swap;
 }
 
 // Function to add a cluster of cells at a random position
 void add_cell_cluster() {
     int cluster_size = 3;  // Size of the cluster (3x3)
-    int x = rand() % (GRID_WIDTH - cluster_size);
-    int y = rand() % (GRID_HEIGHT - cluster_size);
+    int x = hlc_random_below(GRID_WIDTH - cluster_size);
+    int y = hlc_random_below(GRID_HEIGHT - cluster_size);
 
     for (int dy = 0; dy < cluster_size; dy++) {
         for (int dx = 0; dx < cluster_size; dx++) {
-            bool is_alive = rand() % 2; // Randomly choose between 0 and 1
-            grid[y + dy][x + dx] = is_alive;  // Set the cell to be alive
-            changed_grid[y + dy][x + dx] = true; // Mark the cell as changed
+            uint32_t cell = 1UL << (x + dx);
+            if (hlc_random() & 1) { // Randomly choose between 0 and 1
+                grid[y + dy] |= cell;  // Set the cell to be alive
+            } else {
+                grid[y + dy] &= ~cell;
+            }
+            changed_grid[y + dy] |= cell; // Mark the cell as changed
         }
     }
 }
 
-void update_display(void) {
-    static bool first_run_led = false;
-    static bool first_run_layer = false;
+#ifdef HLC_WPM_HISTORY
+// Adds a line to the WPM history band each interval, a bar as long as the WPM
+// in the color of the cells. The band scrolls up in hardware, so only the new
+// line is drawn and sent.
+static void update_wpm_history(void) {
+    static uint32_t last_line = 0;
+    display_color_t line[LCD_WIDTH];
+
+    if (!animation_divider || !hlc_timer_tick(&last_line, HLC_WPM_HISTORY_INTERVAL * animation_divider)) {
+        return;
+    }
 
-    if( first_run_layer == false) {
-        // Load fonts
-        Retron27 = qp_load_font_mem(font_Retron2000_27);
-        Retron27_underline = qp_load_font_mem(font_Retron2000_underline_27);
+    uint16_t length = MIN(get_current_wpm(), HLC_WPM_HISTORY_MAX) * LCD_WIDTH / HLC_WPM_HISTORY_MAX;
+    display_color_t color = life_color();
+    for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+        line[x] = x < length ? color : DISPLAY_COLOR_BLACK;
     }
 
-    if(last_led_usb_state.raw != host_keyboard_led_state().raw || first_run_led == false) {
-        led_t led_usb_state = host_keyboard_led_state();
+    display_scroll(1);
+    display_write_row(0, display_scroll_row(HLC_WPM_HISTORY_HEIGHT - 1), line, LCD_WIDTH);
+}
+#endif
+
+static bool lock_is_on(led_t led_state, lock_label_t lock) {
+    switch (lock) {
+    case LOCK_CAPS:
+        return led_state.caps_lock;
+    case LOCK_NUM:
+        return led_state.num_lock;
+    default:
+        return led_state.scroll_lock;
+    }
+}
+
+// True while the current housekeeping pass is within its budget
+static bool pass_has_time(void) {
+    return hlc_timer_read_us() - pass_start < HLC_DISPLAY_PASS_BUDGET_US;
+}
+
+// Layer number, drawn in slices of rows
+#define LAYER_SLICE_ROWS 16
+
+static uint32_t layer_widget_state(const widget_t *widget) {
+    uint8_t layer = get_highest_layer(layer_state|default_layer_state);
+    return layer < LAYER_PALETTE_SIZE ? layer : LAYER_PALETTE_SIZE - 1;
+}
+
+static bool layer_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    hlc_asset_id_t asset = layer_assets[state];
+    display_color_t color = display_color(layer_palette[state][0], layer_palette[state][1], layer_palette[state][2]);
+    display_draw_asset_rows(asset, widget->left, widget->top, step * LAYER_SLICE_ROWS, LAYER_SLICE_ROWS, color, DISPLAY_COLOR_BLACK);
+    return (step + 1) * LAYER_SLICE_ROWS >= hlc_assets[asset].height;
+}
 
-        led_usb_state.caps_lock   ? qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height * 3 - 15, Retron27_underline, caps,   HSV_CAPS_ON,   HSV_BLACK) : qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height * 3 - 15, Retron27, caps,   HSV_CAPS_OFF,   HSV_BLACK);
-        led_usb_state.num_lock    ? qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height * 2 - 10, Retron27_underline, num,    HSV_NUM_ON,    HSV_BLACK) : qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height * 2 - 10, Retron27, num,    HSV_NUM_OFF,    HSV_BLACK);
-        led_usb_state.scroll_lock ? qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height - 5,      Retron27_underline, scroll, HSV_SCROLL_ON, HSV_BLACK) : qp_drawtext_recolor(lcd_surface, 5, LCD_HEIGHT - Retron27->line_height - 5,      Retron27, scroll, HSV_SCROLL_OFF, HSV_BLACK);
+static uint32_t lock_widget_state(const widget_t *widget) {
+    return lock_is_on(host_keyboard_led_state(), widget->arg);
+}
 
-        last_led_usb_state = led_usb_state;
-        first_run_led = true;
+static bool lock_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    const uint8_t *hsv = lock_colors[widget->arg][state];
+    display_draw_asset(lock_assets[widget->arg][state], widget->left, widget->top, display_color(hsv[0], hsv[1], hsv[2]), DISPLAY_COLOR_BLACK);
+    return true;
+}
+
+// Small text widgets between the layer number and the lock labels
+#define SMALL_TEXT_SCALE 2
+#define SMALL_TEXT_WIDTH(chars) ((chars) * DISPLAY_SMALL_PITCH(SMALL_TEXT_SCALE))
+#define SMALL_TEXT_HEIGHT (5 * SMALL_TEXT_SCALE)
+
+static void draw_small_text(const widget_t *widget, const char *text, uint8_t hue, uint8_t sat, uint8_t val) {
+    display_draw_small_text(widget->left, widget->top, text, SMALL_TEXT_SCALE, display_color(hue, sat, val), DISPLAY_COLOR_BLACK);
+}
+
+// Ctrl, Shift, Alt and GUI, left and right combined
+static uint32_t mods_widget_state(const widget_t *widget) {
+    uint8_t mods = get_mods() | get_oneshot_mods();
+    return (mods | mods >> 4) & 0x0F;
+}
+
+static bool mods_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    static const char letters[] = "CSAG";
+    display_color_t off = display_color(HSV_MOD_OFF);
+    display_color_t on = display_color(HSV_MOD_ON);
+
+    for (uint8_t i = 0; i < 4; i++) {
+        char text[2] = { letters[i], '\0' };
+        display_draw_small_text(widget->left + SMALL_TEXT_WIDTH(i), widget->top, text, SMALL_TEXT_SCALE, state & (1 << i) ? on : off, DISPLAY_COLOR_BLACK);
     }
+    return true;
+}
 
-    if(last_layer_state != layer_state || first_run_layer == false) {
-        switch (get_highest_layer(layer_state|default_layer_state)) {
-        case 0:
-            layer_number = qp_load_image_mem(gfx_0);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_0, HSV_BLACK);
-            break;
-        case 1:
-            layer_number = qp_load_image_mem(gfx_1);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_1, HSV_BLACK);
-            break;
-        case 2:
-            layer_number = qp_load_image_mem(gfx_2);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_2, HSV_BLACK);
-            break;
-        case 3:
-            layer_number = qp_load_image_mem(gfx_3);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_3, HSV_BLACK);
-            break;
-        case 4:
-            layer_number = qp_load_image_mem(gfx_4);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_4, HSV_BLACK);
-            break;
-        case 5:
-            layer_number = qp_load_image_mem(gfx_5);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_5, HSV_BLACK);
-            break;
-        case 6:
-            layer_number = qp_load_image_mem(gfx_6);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_6, HSV_BLACK);
-            break;
-        case 7:
-            layer_number = qp_load_image_mem(gfx_7);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_7, HSV_BLACK);
-            break;
-        default:
-            layer_number = qp_load_image_mem(gfx_undef);
-            qp_drawimage_recolor(lcd_surface, 5, 5, layer_number, HSV_LAYER_UNDEF, HSV_BLACK);
-        }
-        qp_close_image(layer_number);
-        last_layer_state = layer_state;
-        first_run_layer = true;
+#ifdef OS_DETECTION_ENABLE
+static uint32_t os_widget_state(const widget_t *widget) {
+    return detected_host_os();
+}
+
+static bool os_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    static const char *const os_names[] = {
+        [OS_LINUX] = "LNX", [OS_WINDOWS] = "WIN", [OS_MACOS] = "MAC", [OS_IOS] = "IOS",
+    };
+    const char *name = state < ARRAY_SIZE(os_names) && os_names[state] ? os_names[state] : "???";
+
+    draw_small_text(widget, name, HSV_INFO);
+    return true;
+}
+#endif
+
+#ifdef WPM_ENABLE
+static uint32_t wpm_widget_state(const widget_t *widget) {
+    return get_current_wpm();
+}
+
+static bool wpm_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    char text[8] = "WPM ";
+    strcpy(&text[4], get_u8_str(state, ' '));
+    draw_small_text(widget, text, HSV_INFO);
+    return true;
+}
+#endif
+
+#ifdef RGB_MATRIX_ENABLE
+static uint32_t rgb_widget_state(const widget_t *widget) {
+    return rgb_matrix_is_enabled() << 8 | rgb_matrix_get_mode();
+}
+
+static bool rgb_widget_draw(const widget_t *widget, uint32_t state, uint16_t step) {
+    char text[8] = "RGB OFF";
+    if (state >> 8) {
+        strcpy(&text[4], get_u8_str(state & 0xFF, ' '));
     }
+    draw_small_text(widget, text, HSV_INFO);
+    return true;
+}
+#endif
+
+#define LOCK_WIDGET(lock, name) \
+    { .left = 5, .top = LOCK_LABEL_Y(lock), .right = 5 + LOCK_BOX_WIDTH(name) - 1, .bottom = LOCK_LABEL_Y(lock) + LOCK_BOX_HEIGHT(name) - 1, .arg = lock, .state = lock_widget_state, .draw = lock_widget_draw }
+#define SMALL_TEXT_WIDGET(x, y, chars, interval, name) \
+    { .left = x, .top = y, .right = x + SMALL_TEXT_WIDTH(chars) - 1, .bottom = y + SMALL_TEXT_HEIGHT - 1, .refresh_interval = interval, .state = name##_widget_state, .draw = name##_widget_draw }
+
+static const widget_t master_widgets[] = {
+    // The layer numbers all share the size of 0
+    { .left = 5, .top = 5, .right = 5 + HLC_ASSET_LAYER_0_WIDTH - 1, .bottom = 5 + HLC_ASSET_LAYER_0_TOP + HLC_ASSET_LAYER_0_HEIGHT - 1, .state = layer_widget_state, .draw = layer_widget_draw },
+    LOCK_WIDGET(LOCK_CAPS, CAPS),
+    LOCK_WIDGET(LOCK_NUM, NUM),
+    LOCK_WIDGET(LOCK_SCROLL, SCROLL),
+    SMALL_TEXT_WIDGET(5, 112, 4, 50, mods),
+#ifdef OS_DETECTION_ENABLE
+    SMALL_TEXT_WIDGET(70, 112, 3, 1000, os),
+#endif
+#ifdef WPM_ENABLE
+    SMALL_TEXT_WIDGET(5, 124, 7, 250, wpm),
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    SMALL_TEXT_WIDGET(70, 124, 7, 100, rgb),
+#endif
+};
+static widget_status_t master_widget_status[ARRAY_SIZE(master_widgets)];
+
+// Makes every master widget redraw on the next passes, e.g. after something
+// else drew over them
+void display_redraw_widgets(void) {
+    widgets_invalidate(master_widget_status, ARRAY_SIZE(master_widgets));
 }
 
-// Called from halcyon.c
-void module_suspend_power_down_kb(void) {
-    qp_power(lcd, false);
+// Called from hlc_tft_hid.c for every report of a host frame
+void display_host_frame_report(void) {
+    host_frame_open = true;
+    host_frame_report = hlc_timer_read32();
 }
 
-// Called from halcyon.c
-void module_suspend_wakeup_init_kb(void) {
-    qp_power(lcd, true);
+// Called from hlc_tft_hid.c once the host frame is complete
+void display_host_frame_end(void) {
+    host_frame_open = false;
 }
 
-// Called from halcyon.c
-bool module_post_init_kb(void) {
-    // Turn on backlight
-    backlight_enable();
+// Called from hlc_tft_hid.c before the host draws into a rectangle, hides the
+// widgets it overlaps until the host content is given up
+void display_host_area(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    if (host_area_shown) {
+        host_area_left = MIN(host_area_left, left);
+        host_area_top = MIN(host_area_top, top);
+        host_area_right = MAX(host_area_right, right);
+        host_area_bottom = MAX(host_area_bottom, bottom);
+    } else {
+        host_area_left = left;
+        host_area_top = top;
+        host_area_right = right;
+        host_area_bottom = bottom;
+        host_area_shown = true;
+    }
+    widgets_hide(master_widgets, master_widget_status, ARRAY_SIZE(master_widgets), left, top, right, bottom);
+}
 
-    // Make the devices
-    lcd = qp_st7789_make_spi_device(LCD_WIDTH, LCD_HEIGHT, LCD_CS_PIN, LCD_DC_PIN, LCD_RST_PIN, LCD_SPI_DIVISOR, LCD_SPI_MODE);
-    lcd_surface = qp_make_rgb565_surface(LCD_WIDTH, LCD_HEIGHT, lcd_surface_fb);
+// True while a host frame is still arriving, unless the host went quiet
+static bool host_frame_pending(void) {
+    if (host_frame_open && TIMER_DIFF_32(hlc_timer_read32(), host_frame_report) >= HLC_DISPLAY_HID_FRAME_TIMEOUT) {
+        host_frame_open = false;
+    }
+    return host_frame_open;
+}
 
-    // Initialise the LCD
-    qp_init(lcd, LCD_ROTATION);
-    qp_set_viewport_offsets(lcd, LCD_OFFSET_X, LCD_OFFSET_Y);
-    qp_clear(lcd);
-    qp_rect(lcd, 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, HSV_BLACK, true);
-    qp_power(lcd, true);
-    qp_flush(lcd);
+// Clears the host area once the host stopped sending, and brings back the widgets it hid
+static void host_area_step(void) {
+    if (!host_area_shown || host_frame_pending() || TIMER_DIFF_32(hlc_timer_read32(), host_frame_report) < HLC_DISPLAY_HID_HOLD) {
+        return;
+    }
+    display_fill_rect(host_area_left, host_area_top, host_area_right, host_area_bottom, DISPLAY_COLOR_BLACK);
+    widgets_show(master_widget_status, ARRAY_SIZE(master_widgets));
+    host_area_shown = false;
+}
 
-    // Initialise the LCD surface
-    qp_init(lcd_surface, LCD_ROTATION);
-    qp_rect(lcd_surface, 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, HSV_BLACK, true);
-    qp_surface_draw(lcd_surface, lcd, 0, 0, 0);
-    qp_flush(lcd);
+// Redraws the widgets whose inputs changed, within the pass budget
+void update_display(void) {
+    host_area_step();
+    widgets_pending = widgets_update(master_widgets, master_widget_status, ARRAY_SIZE(master_widgets), pass_has_time);
+}
 
-    if(!module_post_init_user()) { return false; }
+// Draws the generation a row per step, then advances the simulation
+static void update_life(void) {
+    static uint32_t previous_matrix_activity_time = 0;
+
+    while (life_drawing && pass_has_time()) {
+        draw_grid_row(life_row++);
+        if (life_row < GRID_HEIGHT) {
+            continue;
+        }
 
+        update_grid();
+        if (previous_matrix_activity_time != last_matrix_activity_time()) {
+            color_value = hlc_random_below(8);
+            add_cell_cluster();
+            previous_matrix_activity_time = last_matrix_activity_time();
+        }
+        life_drawing = false;
+    }
+}
+
+// Sends the previous frame on, returns true once it is out and the surface may be drawn into
+static bool flush_step(void) {
+#ifdef LCD_ASYNC_FLUSH
+    // DMA does the sending, a pass only queues the next chunk
+    return !display_flush_busy();
+#else
+    while (display_flush_busy()) {
+        if (!pass_has_time()) {
+            return false;
+        }
+    }
     return true;
+#endif
 }
 
-// Called from halcyon.c
-bool display_module_housekeeping_task_kb(bool second_display) {
+// Switches the panel to lcd_on once no frame is going out, returns false while it waits
+static bool lcd_power_step(void) {
+    if (lcd_powered == lcd_on) {
+        return true;
+    }
+    if (!flush_step()) {
+        return false;
+    }
+    qp_power(lcd, lcd_on);
+    lcd_powered = lcd_on;
+    if (lcd_on) {
+        // Widget states went unchecked while it was off
+        display_redraw_widgets();
+    }
+    return true;
+}
+
+static bool render_pass(bool second_display) {
+#ifdef HLC_PERF_OVERLAY
+    static uint32_t render_time = 0; // Drawing time of the frame so far, over all passes
+    static uint32_t flush_start = 0;
+    static bool flushing = false;
+#endif
+
+    // The user hook runs on every pass, also while the LCD is off or a frame is
+    // going out. With LCD_ASYNC_FLUSH the SPI bus is then busy: Quantum Painter
+    // calls on lcd have to wait until display_is_flushing() is false, drawing
+    // into the surface through hlc_tft_surface.h needs the same.
     if(!display_module_housekeeping_task_user(second_display)) { return false; }
 
+    // Nothing to show with the LCD off, drawing resumes where it was once it is back on
+    if(!lcd_power_step() || !lcd_on) { return true; }
+
+    if(!flush_step()) { return true; }
+
+#ifdef HLC_PERF_OVERLAY
+    if (flushing) {
+        overlay_frame_flushed(hlc_timer_read_us() - flush_start);
+        flushing = false;
+    }
+    uint32_t render_start = hlc_timer_read_us();
+#endif
+
     if(second_display) {
-        static uint32_t last_draw = 0;
+        static uint32_t last_frame = 0;
         static bool second_display_set = false;
-        static uint32_t previous_matrix_activity_time = 0;
 
         if(!second_display_set) {
-            srand(get_random_32bit());
+            hlc_random_seed();
             init_grid();
-            color_value = rand() % 8;
+            color_value = hlc_random_below(8);
+#ifdef HLC_WPM_HISTORY
+            display_scroll_setup(LIFE_HEIGHT, HLC_WPM_HISTORY_HEIGHT);
+#endif
             second_display_set = true;
         }
 
-        if (timer_elapsed32(last_draw) >= 100) { // Throttle to 10 fps
-            draw_grid();
-            update_grid();
-
-            if (previous_matrix_activity_time != last_matrix_activity_time()) {
-                color_value = rand() % 8;
-                add_cell_cluster();
-                previous_matrix_activity_time = last_matrix_activity_time();
-            }
-
-            last_draw = timer_read32();
+        // 10 fps, in phase with the master. A generation still being drawn skips the tick.
+        if (animation_divider && hlc_timer_tick(&last_frame, HLC_DISPLAY_FRAME_INTERVAL * animation_divider) && !life_drawing) {
+            life_drawing = true;
+            life_row = 0;
         }
+        update_life();
+#ifdef HLC_WPM_HISTORY
+        update_wpm_history();
+#endif
     }
 
     // Update display information (layers, numlock, etc.)
@@ -316,9 +562,97 @@ bool display_module_housekeeping_task_kb(bool second_display) {
         update_display();
     }
 
-    // Move surface to lcd
-    qp_surface_draw(lcd_surface, lcd, 0, 0, 0);
+    // Move complete frames from the surface to the lcd
+    if(!life_drawing && !widgets_pending && !host_frame_pending()) {
+#ifdef HLC_PERF_OVERLAY
+        // Drawn last so it stays on top of the rest of the frame
+        if (display_is_dirty() || overlay_changed()) {
+            overlay_draw();
+        }
+        render_time += hlc_timer_read_us() - render_start;
+        flush_start = hlc_timer_read_us();
+        if (display_flush()) {
+            overlay_frame_rendered(render_time);
+            flushing = true;
+        }
+        // Idle frames drew nothing, their time does not belong to the next frame
+        render_time = 0;
+        return true;
+#else
+        display_flush();
+#endif
+    }
+
+#ifdef HLC_PERF_OVERLAY
+    render_time += hlc_timer_read_us() - render_start;
+#endif
+    return true;
+}
+
+// Called from halcyon.c, over and over while suspended. Each call sends at
+// most one chunk, the panel goes off once the frame is out.
+void module_suspend_power_down_kb(void) {
+    if (lcd_powered && !display_flush_busy()) {
+        qp_power(lcd, false);
+        lcd_powered = false;
+    }
+}
+
+// Called from halcyon.c. The panel is left alone, a frame may still be going
+// out: lcd_power_step() switches it back on in a pass once it is sent.
+void module_suspend_wakeup_init_kb(void) {}
+
+// Called from halcyon.c with every raw HID report
+bool module_raw_hid_receive_kb(uint8_t *data, uint8_t length) {
+#ifdef HLC_DISPLAY_HID
+    if (display_hid_receive(data, length)) {
+        return true;
+    }
+#endif
+#ifdef HLC_DISPLAY_STATS
+    if (display_stats_hid_receive(data, length)) {
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Called from hlc_idle.c
+void module_idle_tier_kb(const hlc_idle_settings_t *settings) {
+    animation_divider = settings->animation_divider;
+    // render_pass applies it, after the frame being sent
+    lcd_on = settings->lcd;
+}
+
+// Called from halcyon.c
+bool module_post_init_kb(void) {
+    // Turn on backlight
+    backlight_enable();
+
+    // Make the devices
+    lcd = qp_st7789_make_spi_device(LCD_WIDTH, LCD_HEIGHT, LCD_CS_PIN, LCD_DC_PIN, LCD_RST_PIN, LCD_SPI_DIVISOR, LCD_SPI_MODE);
+
+    // Initialise the LCD
+    qp_init(lcd, LCD_ROTATION);
+    qp_set_viewport_offsets(lcd, LCD_OFFSET_X, LCD_OFFSET_Y);
+    qp_clear(lcd);
+    qp_rect(lcd, 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, HSV_BLACK, true);
+    qp_power(lcd, true);
     qp_flush(lcd);
 
+    // Initialise the framebuffer
+    display_surface_init();
+
+    if(!module_post_init_user()) { return false; }
+
     return true;
 }
+
+// Called from halcyon.c
+bool display_module_housekeeping_task_kb(bool second_display) {
+    pass_start = hlc_timer_read_us();
+#ifdef HLC_PERF_OVERLAY
+    overlay_pass();
+#endif
+    return render_pass(second_display);
+}
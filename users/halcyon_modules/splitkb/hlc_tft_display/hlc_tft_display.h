@@ -5,6 +5,7 @@
 
 #include "qp.h"
 #include "qp_surface.h"
+#include "hlc_tft_surface.h"
 
 // All values (including hue) are scaled to 0-255
 #define HSV_SPLITKB 145, 235, 155
@@ -14,6 +15,9 @@
 #define HSV_SCROLL_ON 202, 191, 245
 #define HSV_NUM_OFF 142, 104, 77
 #define HSV_NUM_ON 142, 191, 245
+#define HSV_MOD_OFF 0, 0, 77
+#define HSV_MOD_ON 0, 0, 245
+#define HSV_INFO 0, 0, 160
 
 #define HSV_LAYER_0 0, 0, 160
 #define HSV_LAYER_3 0, 82, 255
@@ -27,13 +31,14 @@
 #define HSV_LAYER_UNDEF 0, 255, 255
 
 extern painter_device_t lcd;
-extern painter_device_t lcd_surface;
 
-void draw_grid(void);
 void update_grid(void);
 void init_grid(void);
 void add_cell_cluster(void);
 uint8_t get_random_color_index(void);
 void update_display(void);
-void backlight_wakeup(void);
-void backlight_suspend(void);
+void display_redraw_widgets(void);
+void display_host_frame_report(void);
+void display_host_frame_end(void);
+void display_host_area(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+bool display_hid_receive(uint8_t *data, uint8_t length);
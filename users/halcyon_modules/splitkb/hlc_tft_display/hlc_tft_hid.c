@@ -0,0 +1,175 @@
+// Host streamed display content over raw HID
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Every 32 byte report starts with HID_DISPLAY_ID, an operation and a sequence
+// number, and is answered with the same three bytes plus a status:
+//
+//   BEGIN  x, y, width, height        Select a region and start a frame there, any
+//                                     sequence number is accepted and restarts the count
+//   RLE    (count, color hi, lo) ...  Runs of rgb565 pixels, filled left to right and
+//                                     top to bottom from the region start, count 0 ends
+//   TEXT   x, y, scale, color hi, lo, Small uppercase text at screen coordinates
+//          text\0
+//   END                               The frame is complete and may be shown
+//
+// The host sends a report after the previous one was answered. BUSY means the
+// last frame is still being sent to the lcd, send the same report again later.
+// SEQUENCE means a report was lost, byte 4 holds the sequence number expected.
+// Pixels are drawn straight into the framebuffer. Nothing is sent to the lcd
+// between BEGIN and END, so a frame shows up whole, unless no report arrives
+// for HLC_DISPLAY_HID_FRAME_TIMEOUT ms. Colors are rgb565, but with
+// LCD_INDEXED_SURFACE they share the 16 entry palette with everything else on
+// screen: once it is full a color becomes the closest entry.
+//
+// Widgets under a BEGIN region or TEXT are hidden from then on, so they don't
+// draw over the host content. HLC_DISPLAY_HID_HOLD ms after the last report the
+// area is cleared and they come back. The default master layout leaves x 80 and
+// up free down to y 109, to the right of the layer number.
+
+#include "halcyon.h"
+#include "hlc_tft_display.h"
+#include "raw_hid.h"
+
+#define HID_DISPLAY_ID 0x48 // Not used by VIA
+
+enum hid_display_op {
+    HID_DISPLAY_BEGIN = 1,
+    HID_DISPLAY_RLE,
+    HID_DISPLAY_TEXT,
+    HID_DISPLAY_END,
+};
+
+enum hid_display_status {
+    HID_DISPLAY_OK,
+    HID_DISPLAY_BUSY,
+    HID_DISPLAY_SEQUENCE,
+    HID_DISPLAY_ERROR,
+};
+
+#define HID_HEADER_SIZE 3
+
+static uint16_t region_left = 0;
+static uint16_t region_top = 0;
+static uint16_t region_width = 0;
+static uint16_t region_height = 0;
+static uint16_t cursor_x = 0; // Next pixel of the region, relative to its corner
+static uint16_t cursor_y = 0;
+static uint8_t expected_sequence = 0;
+
+static display_color_t payload_color(const uint8_t *data) {
+    return display_color_rgb565(data[0] << 8 | data[1]);
+}
+
+static uint8_t begin_region(const uint8_t *payload) {
+    if (payload[0] >= LCD_WIDTH || payload[1] >= LCD_HEIGHT || payload[2] == 0 || payload[3] == 0) {
+        return HID_DISPLAY_ERROR;
+    }
+
+    region_left = payload[0];
+    region_top = payload[1];
+    region_width = payload[2];
+    region_height = payload[3];
+    if (region_left + region_width > LCD_WIDTH) region_width = LCD_WIDTH - region_left;
+    if (region_top + region_height > LCD_HEIGHT) region_height = LCD_HEIGHT - region_top;
+    cursor_x = 0;
+    cursor_y = 0;
+    display_host_area(region_left, region_top, region_left + region_width - 1, region_top + region_height - 1);
+    return HID_DISPLAY_OK;
+}
+
+static uint8_t draw_runs(const uint8_t *payload, uint8_t length) {
+    for (uint8_t i = 0; i + 3 <= length && payload[i] != 0; i += 3) {
+        uint16_t count = payload[i];
+        display_color_t color = payload_color(&payload[i + 1]);
+
+        // A run continues on the next row when it reaches the region edge
+        while (count && cursor_y < region_height) {
+            uint16_t span = region_width - cursor_x;
+            if (span > count) span = count;
+
+            uint16_t x = region_left + cursor_x;
+            uint16_t y = region_top + cursor_y;
+            display_fill_rect(x, y, x + span - 1, y, color);
+
+            count -= span;
+            cursor_x += span;
+            if (cursor_x == region_width) {
+                cursor_x = 0;
+                cursor_y++;
+            }
+        }
+        if (count) {
+            return HID_DISPLAY_ERROR; // More pixels than the region holds
+        }
+    }
+    return HID_DISPLAY_OK;
+}
+
+static uint8_t draw_text(uint8_t *payload, uint8_t length) {
+    if (length < 6 || payload[0] >= LCD_WIDTH || payload[1] >= LCD_HEIGHT) {
+        return HID_DISPLAY_ERROR;
+    }
+
+    payload[length - 1] = '\0';
+    const char *text = (const char *)&payload[5];
+    uint8_t scale = payload[2] ? payload[2] : 1;
+    uint16_t width = MIN((uint16_t)strlen(text) * DISPLAY_SMALL_PITCH(scale), LCD_WIDTH - payload[0]);
+    uint16_t height = MIN(5 * scale, LCD_HEIGHT - payload[1]);
+
+    if (width) {
+        display_host_area(payload[0], payload[1], payload[0] + width - 1, payload[1] + height - 1);
+    }
+    display_draw_small_text(payload[0], payload[1], text, scale, payload_color(&payload[3]), DISPLAY_COLOR_BLACK);
+    return HID_DISPLAY_OK;
+}
+
+// Handles a display report in place, returns false for reports of other features
+bool display_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < HID_HEADER_SIZE + 2 || data[0] != HID_DISPLAY_ID) {
+        return false;
+    }
+
+    uint8_t op = data[1];
+    uint8_t sequence = data[2];
+    uint8_t *payload = &data[HID_HEADER_SIZE];
+    uint8_t payload_length = length - HID_HEADER_SIZE;
+    uint8_t status;
+
+    if (display_is_flushing()) {
+        // Nothing may draw into the surface while it is being sent
+        status = HID_DISPLAY_BUSY;
+    } else if (op != HID_DISPLAY_BEGIN && sequence != expected_sequence) {
+        status = HID_DISPLAY_SEQUENCE;
+    } else {
+        switch (op) {
+            case HID_DISPLAY_BEGIN:
+                status = begin_region(payload);
+                break;
+            case HID_DISPLAY_RLE:
+                status = region_width ? draw_runs(payload, payload_length) : HID_DISPLAY_ERROR;
+                break;
+            case HID_DISPLAY_TEXT:
+                status = draw_text(payload, payload_length);
+                break;
+            case HID_DISPLAY_END:
+                display_host_frame_end();
+                status = HID_DISPLAY_OK;
+                break;
+            default:
+                status = HID_DISPLAY_ERROR;
+                break;
+        }
+        if (status == HID_DISPLAY_OK) {
+            expected_sequence = sequence + 1;
+            if (op != HID_DISPLAY_END) {
+                display_host_frame_report();
+            }
+        }
+    }
+
+    memset(payload, 0, payload_length);
+    payload[0] = status;
+    payload[1] = expected_sequence;
+    raw_hid_send(data, length);
+    return true;
+}
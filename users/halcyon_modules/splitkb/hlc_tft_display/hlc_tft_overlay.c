@@ -0,0 +1,113 @@
+// Performance overlay for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Shows, per second, in the top right corner:
+//   F  frames flushed per second
+//   R  average render time of a frame (us)
+//   M  maximum render time of a frame (us)
+//   S  average time to send a frame to the lcd (us)
+//   L  housekeeping passes per second
+// Values above 9999 are shown in thousands with a K suffix.
+
+#include "halcyon.h"
+#include "hlc_tft_display.h"
+#include "hlc_tft_overlay.h"
+
+#define OVERLAY_SCALE 2
+#define OVERLAY_LINE_HEIGHT (6 * OVERLAY_SCALE) // 5 pixel glyph plus spacing
+#define OVERLAY_CHARS 6                         // Label, space, four digits
+#define OVERLAY_LINES 5
+#define OVERLAY_X (LCD_WIDTH - OVERLAY_CHARS * DISPLAY_SMALL_PITCH(OVERLAY_SCALE))
+#define OVERLAY_Y 5
+
+// Measurements of the running one second window
+static uint32_t window_start = 0;
+static uint32_t passes = 0;
+static uint16_t frames = 0;
+static uint16_t flushes = 0;
+static uint32_t render_sum = 0;
+static uint32_t render_max = 0;
+static uint32_t flush_sum = 0;
+
+static const char overlay_labels[OVERLAY_LINES] = { 'F', 'R', 'M', 'S', 'L' };
+static uint32_t overlay_values[OVERLAY_LINES];
+static bool overlay_dirty = true;
+
+// Called once per housekeeping pass, closes the window every second
+void overlay_pass(void) {
+    uint32_t now = hlc_timer_read_us();
+    uint32_t elapsed = now - window_start;
+
+    passes++;
+    if (elapsed < 1000000) {
+        return;
+    }
+
+    overlay_values[0] = (uint64_t)frames * 1000000 / elapsed;
+    overlay_values[1] = frames ? render_sum / frames : 0;
+    overlay_values[2] = render_max;
+    overlay_values[3] = flushes ? flush_sum / flushes : 0;
+    overlay_values[4] = (uint64_t)passes * 1000000 / elapsed;
+    overlay_dirty = true;
+
+    window_start = now;
+    passes = 0;
+    frames = 0;
+    flushes = 0;
+    render_sum = 0;
+    render_max = 0;
+    flush_sum = 0;
+}
+
+void overlay_frame_rendered(uint32_t render_us) {
+    frames++;
+    render_sum += render_us;
+    if (render_us > render_max) {
+        render_max = render_us;
+    }
+}
+
+void overlay_frame_flushed(uint32_t flush_us) {
+    flushes++;
+    flush_sum += flush_us;
+}
+
+bool overlay_changed(void) {
+    return overlay_dirty;
+}
+
+static void format_line(char *text, char label, uint32_t value) {
+    bool thousands = value > 9999;
+    if (thousands) {
+        value /= 1000;
+        if (value > 999) value = 999;
+    }
+
+    text[0] = label;
+    text[1] = ' ';
+    for (int8_t i = OVERLAY_CHARS - 1; i >= 2; i--) {
+        if (thousands && i == OVERLAY_CHARS - 1) {
+            text[i] = 'K';
+        } else if (value || i == OVERLAY_CHARS - 1) {
+            text[i] = '0' + value % 10;
+            value /= 10;
+        } else {
+            text[i] = ' ';
+        }
+    }
+    text[OVERLAY_CHARS] = '\0';
+}
+
+// Draws the overlay on top of whatever else is on the surface
+void overlay_draw(void) {
+    display_color_t color = display_color(HSV_WHITE);
+    char text[OVERLAY_CHARS + 1];
+
+    display_fill_rect(OVERLAY_X - OVERLAY_SCALE, OVERLAY_Y - OVERLAY_SCALE, LCD_WIDTH - 1, OVERLAY_Y + OVERLAY_LINES * OVERLAY_LINE_HEIGHT - 1, DISPLAY_COLOR_BLACK);
+    for (uint8_t i = 0; i < OVERLAY_LINES; i++) {
+        format_line(text, overlay_labels[i], overlay_values[i]);
+        display_draw_small_text(OVERLAY_X, OVERLAY_Y + i * OVERLAY_LINE_HEIGHT, text, OVERLAY_SCALE, color, DISPLAY_COLOR_BLACK);
+    }
+
+    overlay_dirty = false;
+}
@@ -0,0 +1,13 @@
+// Performance overlay for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+void overlay_pass(void);
+void overlay_frame_rendered(uint32_t render_us);
+void overlay_frame_flushed(uint32_t flush_us);
+bool overlay_changed(void);
+void overlay_draw(void);
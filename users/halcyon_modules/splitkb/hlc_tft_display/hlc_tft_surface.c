@@ -0,0 +1,677 @@
+// Framebuffer, assets and flushing for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "halcyon.h"
+#include "hlc_tft_display.h"
+
+#include "qp_comms.h"
+
+#ifdef LCD_ASYNC_FLUSH
+#    include "spi_master.h"
+#endif
+#ifdef HLC_DISPLAY_STATS
+#    include "raw_hid.h"
+
+#    define HID_STATS_ID 0x4A // After the display stream and the profiler, not used by VIA
+
+enum hid_stats_op {
+    HID_STATS_FRAME = 1,
+    HID_STATS_DUMP,
+};
+#endif
+
+// ST7789 vertical scrolling, over the 320 rows of panel memory
+#define ST7789_MEMORY_ROWS 320
+#define ST7789_SCROLL_AREA 0x33  // VSCRDEF: top fixed, scrolled and bottom fixed rows
+#define ST7789_SCROLL_START 0x37 // VSCSAD: memory row shown first in the scrolled area
+
+#ifdef LCD_INDEXED_SURFACE
+// Two pixels per byte, low nibble first, each indexing the palette below
+#    define SURFACE_STRIDE ((LCD_WIDTH + 1) / 2)
+#    define PALETTE_SIZE 16
+
+static uint8_t lcd_surface_fb[SURFACE_STRIDE * LCD_HEIGHT] __attribute__((aligned(4)));
+
+// Native colors, entry 0 is always black so a zeroed buffer is a black screen
+static uint16_t palette[PALETTE_SIZE];
+static uint16_t palette_allocated = 1;
+// Entries handed out since the last flush, they may not be in the buffer yet
+static uint16_t palette_pinned = 1;
+#else
+static uint8_t lcd_surface_fb[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(LCD_WIDTH, LCD_HEIGHT, 16)] __attribute__((aligned(4)));
+
+painter_device_t lcd_surface;
+#endif
+
+// Dirty span per surface row, a row is clean when left > right
+static uint8_t dirty_left[LCD_HEIGHT];
+static uint8_t dirty_right[LCD_HEIGHT];
+static bool display_dirty = false;
+static uint16_t flush_row = 0; // First row not yet looked at by the running flush
+
+// Rows are expanded to native rgb565 in chunks on their way to the panel
+#define FLUSH_BUFFER_PIXELS (LCD_FLUSH_CHUNK_ROWS * LCD_WIDTH)
+static uint16_t flush_buffer[FLUSH_BUFFER_PIXELS];
+
+#ifdef HLC_DISPLAY_STATS
+static display_stats_t stats_drawing; // Frame being drawn
+static display_stats_t stats_frame;   // Frame being sent
+#    define STATS_ADD(field, n) (stats_drawing.field += (n))
+#else
+#    define STATS_ADD(field, n)
+#endif
+
+// Hardware scrolled band of full width rows. The framebuffer rows in it follow
+// panel memory, the panel shows them rotated by scroll_offset.
+static uint16_t scroll_top = 0;
+static uint16_t scroll_height = 0;
+static uint16_t scroll_offset = 0;
+static bool scroll_changed = false;
+
+static bool flush_in_progress = false;
+static bool band_active = false;
+static uint16_t band_left;
+static uint16_t band_right;
+static uint16_t band_row; // Next row of the band to send
+static uint16_t band_bottom;
+
+// Converts to the byte swapped rgb565 the panel expects, same as the rgb565 surface does
+static uint16_t native_color(uint8_t hue, uint8_t sat, uint8_t val) {
+    rgb_t rgb = hsv_to_rgb_nocie((hsv_t){hue, sat, val});
+    uint16_t rgb565 = ((rgb.r >> 3) << 11) | ((rgb.g >> 2) << 5) | (rgb.b >> 3);
+    return __builtin_bswap16(rgb565);
+}
+
+#ifdef LCD_INDEXED_SURFACE
+static inline uint8_t fb_get(uint16_t x, uint16_t y) {
+    uint8_t pair = lcd_surface_fb[y * SURFACE_STRIDE + x / 2];
+    return x & 1 ? pair >> 4 : pair & 0x0F;
+}
+
+static inline void fb_set(uint16_t x, uint16_t y, uint8_t index) {
+    uint8_t *pair = &lcd_surface_fb[y * SURFACE_STRIDE + x / 2];
+    *pair = x & 1 ? (*pair & 0x0F) | (index << 4) : (*pair & 0xF0) | index;
+}
+
+static void fb_fill_row(uint16_t x, uint16_t y, uint16_t count, uint8_t index) {
+    uint16_t end = x + count;
+
+    if ((x & 1) && x < end) {
+        fb_set(x++, y, index);
+    }
+    uint16_t pairs = (end - x) / 2;
+    memset(&lcd_surface_fb[y * SURFACE_STRIDE + x / 2], index | (index << 4), pairs);
+    x += pairs * 2;
+    if (x < end) {
+        fb_set(x, y, index);
+    }
+}
+
+// Frees the palette entries no pixel uses anymore
+static void palette_collect(void) {
+    uint16_t in_use = palette_pinned;
+
+    for (uint16_t i = 0; i < sizeof(lcd_surface_fb) && in_use != palette_allocated; i++) {
+        in_use |= (1 << (lcd_surface_fb[i] & 0x0F)) | (1 << (lcd_surface_fb[i] >> 4));
+    }
+    palette_allocated &= in_use;
+}
+
+static uint8_t palette_find_free(void) {
+    for (uint8_t i = 1; i < PALETTE_SIZE; i++) {
+        if (!(palette_allocated & (1 << i))) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static uint8_t palette_nearest(uint16_t native) {
+    uint16_t rgb = __builtin_bswap16(native);
+    uint32_t best_distance = UINT32_MAX;
+    uint8_t best = 0;
+
+    for (uint8_t i = 0; i < PALETTE_SIZE; i++) {
+        if (!(palette_allocated & (1 << i))) continue;
+
+        uint16_t other = __builtin_bswap16(palette[i]);
+        int32_t dr = ((rgb >> 11) - (other >> 11)) * 2;
+        int32_t dg = ((rgb >> 5) & 0x3F) - ((other >> 5) & 0x3F);
+        int32_t db = ((rgb & 0x1F) - (other & 0x1F)) * 2;
+        uint32_t distance = dr * dr + dg * dg + db * db;
+
+        if (distance < best_distance) {
+            best_distance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static uint8_t palette_index(uint16_t native) {
+    for (uint8_t i = 0; i < PALETTE_SIZE; i++) {
+        if ((palette_allocated & (1 << i)) && palette[i] == native) {
+            palette_pinned |= 1 << i;
+            return i;
+        }
+    }
+
+    uint8_t index = palette_find_free();
+    if (index == 0) {
+        palette_collect();
+        index = palette_find_free();
+    }
+    if (index == 0) {
+        // Out of entries, the closest color will have to do
+        index = palette_nearest(native);
+    } else {
+        palette[index] = native;
+        palette_allocated |= 1 << index;
+    }
+    palette_pinned |= 1 << index;
+    return index;
+}
+#endif
+
+static display_color_t display_native(uint16_t native) {
+#ifdef LCD_INDEXED_SURFACE
+    return palette_index(native);
+#else
+    return native;
+#endif
+}
+
+display_color_t display_color(uint8_t hue, uint8_t sat, uint8_t val) {
+    return display_native(native_color(hue, sat, val));
+}
+
+display_color_t display_color_rgb565(uint16_t rgb565) {
+    return display_native(__builtin_bswap16(rgb565));
+}
+
+#ifndef LCD_INDEXED_SURFACE
+static void fb_fill_row(uint16_t x, uint16_t y, uint16_t count, display_color_t color) {
+    uint16_t *pixel = &((uint16_t *)lcd_surface_fb)[y * LCD_WIDTH + x];
+    while (count--) {
+        *pixel++ = color;
+    }
+}
+#endif
+
+static void fb_write_row(uint16_t x, uint16_t y, const display_color_t *colors, uint16_t count) {
+#ifdef LCD_INDEXED_SURFACE
+    for (uint16_t i = 0; i < count; i++) {
+        fb_set(x + i, y, colors[i]);
+    }
+#else
+    memcpy(&((uint16_t *)lcd_surface_fb)[y * LCD_WIDTH + x], colors, count * sizeof(uint16_t));
+#endif
+}
+
+void display_fill_rect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, display_color_t color) {
+    if (right >= LCD_WIDTH) right = LCD_WIDTH - 1;
+    if (bottom >= LCD_HEIGHT) bottom = LCD_HEIGHT - 1;
+    if (left > right || top > bottom) return;
+
+    STATS_ADD(draw_calls, 1);
+    STATS_ADD(pixels_drawn, (uint32_t)(right - left + 1) * (bottom - top + 1));
+    for (uint16_t y = top; y <= bottom; y++) {
+        fb_fill_row(left, y, right - left + 1, color);
+    }
+
+    display_mark_dirty(left, top, right, bottom);
+}
+
+void display_write_row(uint16_t x, uint16_t y, const display_color_t *colors, uint16_t count) {
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT || count == 0) return;
+    if (x + count > LCD_WIDTH) count = LCD_WIDTH - x;
+
+    STATS_ADD(draw_calls, 1);
+    STATS_ADD(pixels_drawn, count);
+    fb_write_row(x, y, colors, count);
+    display_mark_dirty(x, y, x + count - 1, y);
+}
+
+// Skips the given number of run length encoded rows of an asset
+static const uint8_t *asset_skip_rows(const hlc_asset_t *asset, const uint8_t *src, uint16_t rows) {
+    while (rows--) {
+        for (uint16_t covered = 0; covered < asset->width;) {
+            covered += *src++;
+        }
+    }
+    return src;
+}
+
+// Draws rows first_row up to first_row + row_count of a packed asset, set pixels
+// in color and the others in background, so a large asset can be drawn over
+// several passes. (x, y) is the top left of the asset before its blank rows were trimmed.
+void display_draw_asset_rows(hlc_asset_id_t id, uint16_t x, uint16_t y, uint16_t first_row, uint16_t row_count, display_color_t color, display_color_t background) {
+    const hlc_asset_t *asset = &hlc_assets[id];
+    y += asset->top;
+    if (x >= LCD_WIDTH || first_row >= asset->height) return;
+
+    uint16_t width = asset->width;
+    uint16_t end_row = first_row + row_count;
+    if (x + width > LCD_WIDTH) width = LCD_WIDTH - x;
+    if (end_row > asset->height) end_row = asset->height;
+    if (y + end_row > LCD_HEIGHT) end_row = LCD_HEIGHT > y ? LCD_HEIGHT - y : 0;
+    if (first_row >= end_row) return;
+
+    STATS_ADD(draw_calls, 1);
+    STATS_ADD(pixels_drawn, (uint32_t)width * (end_row - first_row));
+
+    const uint8_t *src = &hlc_asset_data[asset->offset];
+    if (asset->encoding == HLC_ASSET_RLE) {
+        // Runs alternate between background and color, filled as spans
+        src = asset_skip_rows(asset, src, first_row);
+        for (uint16_t row = first_row; row < end_row; row++) {
+            bool set = false;
+            for (uint16_t covered = 0; covered < asset->width; set = !set) {
+                uint16_t run = *src++;
+                if (covered < width) {
+                    fb_fill_row(x + covered, y + row, covered + run > width ? width - covered : run, set ? color : background);
+                }
+                covered += run;
+            }
+        }
+    } else {
+        uint16_t stride = (asset->width + 7) / 8;
+        display_color_t line[LCD_WIDTH];
+
+        for (uint16_t row = first_row; row < end_row; row++) {
+            const uint8_t *bits = &src[row * stride];
+            for (uint16_t i = 0; i < width; i++) {
+                line[i] = (bits[i / 8] >> (i % 8)) & 1 ? color : background;
+            }
+            fb_write_row(x, y + row, line, width);
+        }
+    }
+
+    display_mark_dirty(x, y + first_row, x + width - 1, y + end_row - 1);
+}
+
+void display_draw_asset(hlc_asset_id_t id, uint16_t x, uint16_t y, display_color_t color, display_color_t background) {
+    display_draw_asset_rows(id, x, y, 0, hlc_assets[id].height, color, background);
+}
+
+// 3x5 glyphs for small text, one row per 3 bits from the top, leftmost pixel in the high bit
+#define GLYPH(r0, r1, r2, r3, r4) ((r0) << 12 | (r1) << 9 | (r2) << 6 | (r3) << 3 | (r4))
+
+static const uint16_t digit_glyphs[10] = {
+    GLYPH(0b111, 0b101, 0b101, 0b101, 0b111), GLYPH(0b010, 0b110, 0b010, 0b010, 0b111),
+    GLYPH(0b111, 0b001, 0b111, 0b100, 0b111), GLYPH(0b111, 0b001, 0b111, 0b001, 0b111),
+    GLYPH(0b101, 0b101, 0b111, 0b001, 0b001), GLYPH(0b111, 0b100, 0b111, 0b001, 0b111),
+    GLYPH(0b111, 0b100, 0b111, 0b101, 0b111), GLYPH(0b111, 0b001, 0b001, 0b010, 0b010),
+    GLYPH(0b111, 0b101, 0b111, 0b101, 0b111), GLYPH(0b111, 0b101, 0b111, 0b001, 0b111),
+};
+
+static const uint16_t letter_glyphs[26] = {
+    GLYPH(0b010, 0b101, 0b111, 0b101, 0b101), GLYPH(0b110, 0b101, 0b110, 0b101, 0b110), // A B
+    GLYPH(0b011, 0b100, 0b100, 0b100, 0b011), GLYPH(0b110, 0b101, 0b101, 0b101, 0b110), // C D
+    GLYPH(0b111, 0b100, 0b110, 0b100, 0b111), GLYPH(0b111, 0b100, 0b110, 0b100, 0b100), // E F
+    GLYPH(0b011, 0b100, 0b101, 0b101, 0b011), GLYPH(0b101, 0b101, 0b111, 0b101, 0b101), // G H
+    GLYPH(0b111, 0b010, 0b010, 0b010, 0b111), GLYPH(0b001, 0b001, 0b001, 0b101, 0b010), // I J
+    GLYPH(0b101, 0b101, 0b110, 0b101, 0b101), GLYPH(0b100, 0b100, 0b100, 0b100, 0b111), // K L
+    GLYPH(0b101, 0b111, 0b111, 0b101, 0b101), GLYPH(0b110, 0b101, 0b101, 0b101, 0b101), // M N
+    GLYPH(0b010, 0b101, 0b101, 0b101, 0b010), GLYPH(0b110, 0b101, 0b110, 0b100, 0b100), // O P
+    GLYPH(0b010, 0b101, 0b101, 0b110, 0b011), GLYPH(0b110, 0b101, 0b110, 0b101, 0b101), // Q R
+    GLYPH(0b011, 0b100, 0b010, 0b001, 0b110), GLYPH(0b111, 0b010, 0b010, 0b010, 0b010), // S T
+    GLYPH(0b101, 0b101, 0b101, 0b101, 0b111), GLYPH(0b101, 0b101, 0b101, 0b101, 0b010), // U V
+    GLYPH(0b101, 0b101, 0b111, 0b111, 0b101), GLYPH(0b101, 0b101, 0b010, 0b101, 0b101), // W X
+    GLYPH(0b101, 0b101, 0b010, 0b010, 0b010), GLYPH(0b111, 0b001, 0b010, 0b100, 0b111), // Y Z
+};
+
+static uint16_t glyph(char c) {
+    if (c >= '0' && c <= '9') return digit_glyphs[c - '0'];
+    if (c >= 'A' && c <= 'Z') return letter_glyphs[c - 'A'];
+    if (c == '?') return GLYPH(0b110, 0b001, 0b010, 0b000, 0b010);
+    return 0;
+}
+
+// Draws uppercase text with the built-in 3x5 font, each character takes
+// 4 * scale pixels including spacing, on a background of the given color
+void display_draw_small_text(uint16_t x, uint16_t y, const char *text, uint8_t scale, display_color_t color, display_color_t background) {
+    uint16_t pitch = DISPLAY_SMALL_PITCH(scale);
+    uint16_t length = strlen(text);
+    uint16_t height = 5 * scale;
+    display_color_t line[LCD_WIDTH];
+
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return;
+    if (length * pitch > LCD_WIDTH - x) length = (LCD_WIDTH - x) / pitch;
+    if (y + height > LCD_HEIGHT) height = LCD_HEIGHT - y;
+    if (length == 0) return;
+
+    STATS_ADD(draw_calls, 1);
+    STATS_ADD(pixels_drawn, (uint32_t)length * pitch * height);
+    for (uint16_t row = 0; row < height; row++) {
+        for (uint16_t c = 0; c < length; c++) {
+            uint8_t bits = (glyph(text[c]) >> ((4 - row / scale) * 3)) & 0b111;
+            for (uint16_t px = 0; px < pitch; px++) {
+                uint8_t column = px / scale;
+                line[c * pitch + px] = column < 3 && (bits & (0b100 >> column)) ? color : background;
+            }
+        }
+        fb_write_row(x, y + row, line, length * pitch);
+    }
+
+    display_mark_dirty(x, y, x + length * pitch - 1, y + height - 1);
+}
+
+void display_mark_dirty(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    if (right >= LCD_WIDTH) right = LCD_WIDTH - 1;
+    if (bottom >= LCD_HEIGHT) bottom = LCD_HEIGHT - 1;
+    if (left > right || top > bottom) return;
+
+    for (uint16_t y = top; y <= bottom; y++) {
+        if (dirty_left[y] > dirty_right[y]) {
+            dirty_left[y] = left;
+            dirty_right[y] = right;
+        } else {
+            if (left < dirty_left[y]) dirty_left[y] = left;
+            if (right > dirty_right[y]) dirty_right[y] = right;
+        }
+    }
+    display_dirty = true;
+}
+
+// True when something was drawn since the last flush
+bool display_is_dirty(void) {
+    return display_dirty;
+}
+
+// True while a flush is sending the surface, nothing may draw into it then
+bool display_is_flushing(void) {
+    return flush_in_progress;
+}
+
+static void display_clear_dirty(void) {
+    memset(dirty_left, 0xFF, sizeof(dirty_left));
+    memset(dirty_right, 0, sizeof(dirty_right));
+    display_dirty = false;
+}
+
+void display_surface_clear(void) {
+    // Black is zero in both modes
+    memset(lcd_surface_fb, 0, sizeof(lcd_surface_fb));
+#ifdef LCD_INDEXED_SURFACE
+    palette_allocated = 1;
+    palette_pinned = 1;
+#endif
+    display_mark_dirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+}
+
+void display_surface_init(void) {
+#ifndef LCD_INDEXED_SURFACE
+    lcd_surface = qp_make_rgb565_surface(LCD_WIDTH, LCD_HEIGHT, lcd_surface_fb);
+    qp_init(lcd_surface, LCD_ROTATION);
+#endif
+    display_clear_dirty();
+    display_surface_clear();
+    display_scroll_setup(0, 0);
+}
+
+// Makes screen rows top up to top + height scroll in hardware, a height of 0
+// turns scrolling off. The panel must be in LCD_ROTATION QP_ROTATION_0, where
+// its memory rows run down the screen.
+void display_scroll_setup(uint16_t top, uint16_t height) {
+    if (top >= LCD_HEIGHT) height = 0;
+    if (top + height > LCD_HEIGHT) height = LCD_HEIGHT - top;
+
+    scroll_top = top;
+    scroll_height = height;
+    scroll_offset = 0;
+    scroll_changed = true;
+    display_dirty = true;
+}
+
+// Framebuffer row shown as the given row of the scroll area, counted from its top.
+// Draw scrolling content there instead of at screen coordinates.
+uint16_t display_scroll_row(uint16_t row) {
+    if (scroll_height == 0) {
+        return scroll_top + row;
+    }
+    return scroll_top + (scroll_offset + row) % scroll_height;
+}
+
+// Moves the content of the scroll area up by lines without resending it. The
+// bottom lines then show the rows that scrolled off the top, redraw only those.
+void display_scroll(uint16_t lines) {
+    if (scroll_height == 0) return;
+
+    scroll_offset = (scroll_offset + lines) % scroll_height;
+    scroll_changed = true;
+    display_dirty = true;
+}
+
+// Sends the scroll area and offset, before the rows drawn with them go out
+static void send_scroll(void) {
+    uint16_t top_fixed = 0;
+    uint16_t scrolled = ST7789_MEMORY_ROWS;
+    uint16_t start = 0;
+
+    if (scroll_height) {
+        top_fixed = LCD_OFFSET_Y + scroll_top;
+        scrolled = scroll_height;
+        start = top_fixed + scroll_offset;
+    }
+
+    uint16_t bottom_fixed = ST7789_MEMORY_ROWS - top_fixed - scrolled;
+    uint8_t area[6] = { top_fixed >> 8, top_fixed & 0xFF, scrolled >> 8, scrolled & 0xFF, bottom_fixed >> 8, bottom_fixed & 0xFF };
+    uint8_t address[2] = { start >> 8, start & 0xFF };
+
+    qp_comms_start(lcd);
+    qp_comms_command_databuf(lcd, ST7789_SCROLL_AREA, area, sizeof(area));
+    qp_comms_command_databuf(lcd, ST7789_SCROLL_START, address, sizeof(address));
+    qp_comms_stop(lcd);
+    scroll_changed = false;
+}
+
+// Takes the next run of dirty rows whose spans overlap and marks it clean
+static bool next_dirty_band(uint16_t *left, uint16_t *top, uint16_t *right, uint16_t *bottom) {
+    uint16_t y = flush_row;
+
+    while (y < LCD_HEIGHT && dirty_left[y] > dirty_right[y]) y++;
+    if (y >= LCD_HEIGHT) {
+        return false;
+    }
+
+    *top = y;
+    *left = dirty_left[y];
+    *right = dirty_right[y];
+
+    while (y + 1 < LCD_HEIGHT && dirty_left[y + 1] <= dirty_right[y + 1] && dirty_left[y + 1] <= *right && dirty_right[y + 1] >= *left) {
+        y++;
+        if (dirty_left[y] < *left) *left = dirty_left[y];
+        if (dirty_right[y] > *right) *right = dirty_right[y];
+    }
+    *bottom = y;
+
+    memset(&dirty_left[*top], 0xFF, *bottom - *top + 1);
+    memset(&dirty_right[*top], 0, *bottom - *top + 1);
+    flush_row = *bottom + 1;
+    return true;
+}
+
+// Expands rows of a band into native rgb565 for the panel
+static void expand_rows(uint16_t *dst, uint16_t left, uint16_t right, uint16_t top, uint16_t rows) {
+    for (uint16_t y = top; y < top + rows; y++) {
+#ifdef LCD_INDEXED_SURFACE
+        for (uint16_t x = left; x <= right; x++) {
+            *dst++ = palette[fb_get(x, y)];
+        }
+#else
+        uint16_t width = right - left + 1;
+        memcpy(dst, &((uint16_t *)lcd_surface_fb)[y * LCD_WIDTH + left], width * sizeof(uint16_t));
+        dst += width;
+#endif
+    }
+}
+
+static uint16_t chunk_rows(uint16_t width, uint16_t rows_left) {
+    uint16_t rows = FLUSH_BUFFER_PIXELS / width;
+    return rows < rows_left ? rows : rows_left;
+}
+
+static void flush_finished(void) {
+    qp_flush(lcd);
+    display_dirty = false;
+#ifdef LCD_INDEXED_SURFACE
+    palette_pinned = 1;
+#endif
+#ifdef HLC_DISPLAY_STATS
+    dprintf("display: frame %u draw calls, %lu px drawn, %lu px sent\n", stats_frame.draw_calls, (unsigned long)stats_frame.pixels_drawn, (unsigned long)stats_frame.pixels_sent);
+#endif
+}
+
+// Expands the next chunk of the band and sends it. With LCD_ASYNC_FLUSH the
+// transfer runs in the background and the panel stays selected.
+static void send_next_chunk(void) {
+    uint16_t width = band_right - band_left + 1;
+    uint16_t rows = chunk_rows(width, band_bottom - band_row + 1);
+
+    expand_rows(flush_buffer, band_left, band_right, band_row, rows);
+    band_row += rows;
+#ifdef HLC_DISPLAY_STATS
+    stats_frame.pixels_sent += (uint32_t)width * rows;
+#endif
+#ifdef LCD_ASYNC_FLUSH
+    spiStartSend(&SPI_DRIVER, (size_t)width * rows * sizeof(uint16_t), flush_buffer);
+#else
+    qp_pixdata(lcd, flush_buffer, (uint32_t)width * rows);
+#endif
+}
+
+static bool start_next_band(void) {
+    if (!next_dirty_band(&band_left, &band_row, &band_right, &band_bottom)) {
+        return false;
+    }
+
+    qp_viewport(lcd, band_left, band_row, band_right, band_bottom);
+#ifdef LCD_ASYNC_FLUSH
+    spi_start(LCD_CS_PIN, false, LCD_SPI_MODE, LCD_SPI_DIVISOR);
+    gpio_write_pin_high(LCD_DC_PIN);
+#endif
+    return true;
+}
+
+// Advances a running flush by one chunk, returns true while the surface is still being sent
+bool display_flush_busy(void) {
+    if (!flush_in_progress) {
+        return false;
+    }
+#ifdef LCD_ASYNC_FLUSH
+    if (SPI_DRIVER.state != SPI_READY) {
+        return true;
+    }
+#endif
+
+    if (!band_active || band_row > band_bottom) {
+#ifdef LCD_ASYNC_FLUSH
+        if (band_active) {
+            spi_stop();
+        }
+#endif
+        band_active = start_next_band();
+        if (!band_active) {
+            flush_finished();
+            flush_in_progress = false;
+            return false;
+        }
+    }
+
+    send_next_chunk();
+    return true;
+}
+
+// Starts sending the regions drawn since the last flush, display_flush_busy()
+// carries it on. Returns false on idle frames.
+bool display_flush(void) {
+    if (!display_dirty || flush_in_progress) {
+        return false;
+    }
+
+#ifdef HLC_DISPLAY_STATS
+    // Everything drawn up to here belongs to this frame
+    stats_frame = stats_drawing;
+    memset(&stats_drawing, 0, sizeof(stats_drawing));
+#endif
+
+    if (scroll_changed) {
+        send_scroll();
+    }
+
+    flush_row = 0;
+    band_active = false;
+    flush_in_progress = true;
+    display_flush_busy();
+    return true;
+}
+
+#ifdef HLC_DISPLAY_STATS
+// Draw cost of the frame being sent, or of the last one once it is out
+display_stats_t display_frame_stats(void) {
+    return stats_frame;
+}
+
+static uint16_t fb_native(uint16_t x, uint16_t y) {
+#    ifdef LCD_INDEXED_SURFACE
+    return palette[fb_get(x, y)];
+#    else
+    return ((const uint16_t *)lcd_surface_fb)[y * LCD_WIDTH + x];
+#    endif
+}
+
+// Prints the framebuffer to the console as a plain PPM image, so frames can be
+// compared against reference images without a panel attached. Rows of the
+// scroll area are printed in the order the panel shows them.
+void display_dump_frame(void) {
+    uprintf("P3\n%d %d\n255\n", LCD_WIDTH, LCD_HEIGHT);
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        bool scrolled = y >= scroll_top && y < scroll_top + scroll_height;
+        uint16_t row = scrolled ? display_scroll_row(y - scroll_top) : y;
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            uint16_t rgb565 = __builtin_bswap16(fb_native(x, row));
+            uprintf("%u %u %u\n", (rgb565 >> 11) << 3, ((rgb565 >> 5) & 0x3F) << 2, (rgb565 & 0x1F) << 3);
+        }
+    }
+}
+
+static void put_u32(uint8_t *data, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        data[i] = value >> (8 * i);
+    }
+}
+
+// Raw HID reports starting with HID_STATS_ID and an operation:
+//
+//   HID_STATS_FRAME  Answered in place with draw calls (16 bit), pixels drawn
+//                    and pixels sent (32 bit each) of the last frame, little endian
+//   HID_STATS_DUMP   Prints the framebuffer to the console with display_dump_frame()
+//
+// Byte 2 of the answer is 0, or 1 for an unknown operation. Returns false for
+// reports of other features.
+bool display_stats_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 13 || data[0] != HID_STATS_ID) {
+        return false;
+    }
+
+    uint8_t op = data[1];
+    memset(&data[2], 0, length - 2);
+    switch (op) {
+        case HID_STATS_FRAME:
+            data[3] = stats_frame.draw_calls;
+            data[4] = stats_frame.draw_calls >> 8;
+            put_u32(&data[5], stats_frame.pixels_drawn);
+            put_u32(&data[9], stats_frame.pixels_sent);
+            break;
+        case HID_STATS_DUMP:
+            display_dump_frame();
+            break;
+        default:
+            data[2] = 1;
+            break;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
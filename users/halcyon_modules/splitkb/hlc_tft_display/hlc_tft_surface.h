@@ -0,0 +1,57 @@
+// Framebuffer, assets and flushing for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp.h"
+#include "qp_surface.h"
+#include "graphics/hlc_assets.h"
+
+// A color as stored in the framebuffer: native rgb565, or a palette index
+// when LCD_INDEXED_SURFACE is enabled
+typedef uint16_t display_color_t;
+
+// Black is zero in both modes, so a cleared buffer is a black screen
+#define DISPLAY_COLOR_BLACK ((display_color_t)0)
+
+// Draw cost of one frame
+typedef struct {
+    uint16_t draw_calls;
+    uint32_t pixels_drawn; // Written to the framebuffer
+    uint32_t pixels_sent;  // Sent to the lcd
+} display_stats_t;
+
+#ifndef LCD_INDEXED_SURFACE
+extern painter_device_t lcd_surface;
+#endif
+
+void display_surface_init(void);
+void display_surface_clear(void);
+
+display_color_t display_color(uint8_t hue, uint8_t sat, uint8_t val);
+display_color_t display_color_rgb565(uint16_t rgb565);
+void display_fill_rect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, display_color_t color);
+void display_write_row(uint16_t x, uint16_t y, const display_color_t *colors, uint16_t count);
+
+void display_draw_asset(hlc_asset_id_t id, uint16_t x, uint16_t y, display_color_t color, display_color_t background);
+void display_draw_asset_rows(hlc_asset_id_t id, uint16_t x, uint16_t y, uint16_t first_row, uint16_t row_count, display_color_t color, display_color_t background);
+
+// Width of a small text character, including spacing
+#define DISPLAY_SMALL_PITCH(scale) (4 * (scale))
+void display_draw_small_text(uint16_t x, uint16_t y, const char *text, uint8_t scale, display_color_t color, display_color_t background);
+
+void display_mark_dirty(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+bool display_is_dirty(void);
+bool display_is_flushing(void);
+void display_scroll_setup(uint16_t top, uint16_t height);
+uint16_t display_scroll_row(uint16_t row);
+void display_scroll(uint16_t lines);
+
+bool display_flush(void);
+bool display_flush_busy(void);
+
+#ifdef HLC_DISPLAY_STATS
+display_stats_t display_frame_stats(void);
+void display_dump_frame(void);
+bool display_stats_hid_receive(uint8_t *data, uint8_t length);
+#endif
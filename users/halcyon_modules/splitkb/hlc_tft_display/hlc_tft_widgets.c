@@ -0,0 +1,86 @@
+// Widgets for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "halcyon.h"
+#include "hlc_tft_display.h"
+#include "hlc_tft_widgets.h"
+
+// Forces every widget to redraw, e.g. after the surface was cleared
+void widgets_invalidate(widget_status_t *status, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        status[i].drawn = false;
+    }
+}
+
+// Hides the widgets whose rectangle overlaps the given one, they stop drawing
+// so they don't end up on top of what something else drew there
+void widgets_hide(const widget_t *widgets, widget_status_t *status, uint8_t count, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    for (uint8_t i = 0; i < count; i++) {
+        const widget_t *widget = &widgets[i];
+
+        if (widget->left <= right && left <= widget->right && widget->top <= bottom && top <= widget->bottom) {
+            status[i].hidden = true;
+            status[i].drawing = false;
+            status[i].drawn = false;
+        }
+    }
+}
+
+// Shows the hidden widgets again, they redraw on the next passes
+void widgets_show(widget_status_t *status, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        status[i].hidden = false;
+    }
+}
+
+// Starts redraws for widgets whose state changed and whose refresh interval
+// has passed, then takes redraw steps while has_time() allows. Returns true
+// while any redraw is still unfinished.
+bool widgets_update(const widget_t *widgets, widget_status_t *status, uint8_t count, bool (*has_time)(void)) {
+    uint32_t now = hlc_timer_read32();
+    bool pending = false;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const widget_t *widget = &widgets[i];
+        widget_status_t *s = &status[i];
+
+        if (s->hidden) {
+            continue;
+        }
+
+        if (!s->drawing) {
+            if (s->drawn && TIMER_DIFF_32(now, s->last_draw) < widget->refresh_interval) {
+                continue;
+            }
+
+            uint32_t state = widget->state(widget);
+            if (s->drawn && state == s->state) {
+                continue;
+            }
+
+            s->state = state;
+            s->step = 0;
+            s->drawing = true;
+        }
+
+        while (s->drawing && has_time()) {
+            if (s->step == 0) {
+                display_fill_rect(widget->left, widget->top, widget->right, widget->bottom, DISPLAY_COLOR_BLACK);
+                s->step++;
+                continue;
+            }
+
+            if (widget->draw(widget, s->state, s->step - 1)) {
+                s->drawing = false;
+                s->drawn = true;
+                s->last_draw = now;
+            } else {
+                s->step++;
+            }
+        }
+
+        pending |= s->drawing;
+    }
+
+    return pending;
+}
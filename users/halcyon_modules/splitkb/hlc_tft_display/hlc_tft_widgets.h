@@ -0,0 +1,36 @@
+// Widgets for the Halcyon TFT display
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct widget widget_t;
+
+struct widget {
+    uint16_t left;   // Screen rectangle, cleared before each redraw and the
+    uint16_t top;    // only area the widget may draw into
+    uint16_t right;
+    uint16_t bottom;
+    uint16_t refresh_interval; // Minimum time between redraws (ms)
+    uint8_t  arg;              // Passed back to the callbacks, e.g. which lock
+    // Everything the widget shows, folded into one word. A redraw is due when it changes.
+    uint32_t (*state)(const widget_t *widget);
+    // Draws one step of the widget for the given state, returns true when done
+    bool (*draw)(const widget_t *widget, uint32_t state, uint16_t step);
+};
+
+typedef struct {
+    uint32_t state;     // State shown, or being drawn
+    uint32_t last_draw;
+    uint16_t step;      // Next step of a redraw, 0 when it has to clear first
+    bool     drawn;
+    bool     drawing;
+    bool     hidden;    // Something else owns the rectangle, skipped until shown again
+} widget_status_t;
+
+void widgets_invalidate(widget_status_t *status, uint8_t count);
+void widgets_hide(const widget_t *widgets, widget_status_t *status, uint8_t count, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+void widgets_show(widget_status_t *status, uint8_t count);
+bool widgets_update(const widget_t *widgets, widget_status_t *status, uint8_t count, bool (*has_time)(void));
@@ -1,19 +1,35 @@
-SRC += $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_display.c
+SRC += $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_display.c \
+       $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_surface.c \
+       $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_widgets.c
 POST_CONFIG_H += $(USER_PATH)/splitkb/hlc_tft_display/config.h
 
-# Fonts
-SRC += $(USER_PATH)/splitkb/hlc_tft_display/graphics/fonts/Retron2000-27.qff.c \
-       $(USER_PATH)/splitkb/hlc_tft_display/graphics/fonts/Retron2000-underline-27.qff.c
+# Per frame draw statistics and a console frame dump, both requested over raw
+# HID (hlc_tft_surface.c), enable with `-e HLC_DISPLAY_STATS=1`
+ifdef HLC_DISPLAY_STATS
+  RAW_ENABLE = yes
+  OPT_DEFS += -DHLC_DISPLAY_STATS
+endif
 
-# Numbers in image format
-SRC += $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/0.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/1.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/2.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/3.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/4.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/5.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/6.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/7.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/8.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/9.qgf.c \
-	   $(USER_PATH)/splitkb/hlc_tft_display/graphics/numbers/undef.qgf.c
+# Performance overlay, enable with `-e HLC_PERF_OVERLAY=1`
+ifdef HLC_PERF_OVERLAY
+  SRC += $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_overlay.c
+  OPT_DEFS += -DHLC_PERF_OVERLAY
+endif
+
+# Host streamed content over raw HID, enable with `-e HLC_DISPLAY_HID=1`
+ifdef HLC_DISPLAY_HID
+  RAW_ENABLE = yes
+  SRC += $(USER_PATH)/splitkb/hlc_tft_display/hlc_tft_hid.c
+  OPT_DEFS += -DHLC_DISPLAY_HID
+endif
+
+# WPM history band under the Game of Life on the second display, scrolled in
+# hardware, enable with `-e HLC_WPM_HISTORY=1`
+ifdef HLC_WPM_HISTORY
+  WPM_ENABLE = yes
+  OPT_DEFS += -DHLC_WPM_HISTORY
+endif
+
+# Layer numbers and lock labels, packed from graphics/fonts and graphics/numbers
+# by graphics/build_assets.py
+SRC += $(USER_PATH)/splitkb/hlc_tft_display/graphics/hlc_assets.c
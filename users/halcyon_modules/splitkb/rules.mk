@@ -10,10 +10,30 @@ BACKLIGHT_ENABLE = yes
 BACKLIGHT_DRIVER = pwm
 
 VPATH += $(USER_PATH)/splitkb/
-SRC += $(USER_PATH)/splitkb/halcyon.c
+SRC += $(USER_PATH)/splitkb/halcyon.c \
+       $(USER_PATH)/splitkb/hlc_random.c \
+       $(USER_PATH)/splitkb/hlc_backlight.c \
+       $(USER_PATH)/splitkb/hlc_idle.c
 HALCONFDIR += $(USER_PATH)/splitkb/halconf.h
 POST_CONFIG_H += $(USER_PATH)/splitkb/config.h
 
+# Eager press, deferred release debounce instead of the QMK one, enable with
+# `HLC_DEBOUNCE = yes` in the keymap rules.mk
+HLC_DEBOUNCE ?= no
+ifeq ($(strip $(HLC_DEBOUNCE)), yes)
+  DEBOUNCE_TYPE = custom
+  SRC += $(USER_PATH)/splitkb/hlc_debounce.c
+  OPT_DEFS += -DHLC_DEBOUNCE
+endif
+
+# Section timings of the housekeeping pass on the console and over raw HID,
+# enable with `-e HLC_PROFILE=1`
+ifdef HLC_PROFILE
+  RAW_ENABLE = yes
+  SRC += $(USER_PATH)/splitkb/hlc_profile.c
+  OPT_DEFS += -DHLC_PROFILE
+endif
+
 ifdef HLC_ENCODER
   include $(USER_PATH)/splitkb/hlc_encoder/rules.mk
 endif
@@ -0,0 +1,52 @@
+// Host timings of hlc_debounce.c per matrix scan of a half
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Only the relative cost is meaningful, the RP2040 runs the same code at a
+// fraction of the host speed.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "hlc_debounce.h"
+#include "debounce.h"
+#include "timer.h"
+
+#define HALF_ROWS (MATRIX_ROWS / 2)
+#define SCANS 20000000
+
+uint16_t test_timer;
+
+matrix_row_t debounce_fast_keys_user(uint8_t row) {
+    return 0;
+}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+int main(void) {
+    matrix_row_t raw[HALF_ROWS] = { 0 };
+    matrix_row_t cooked[HALF_ROWS] = { 0 };
+    struct timespec start, end;
+
+    debounce_init(HALF_ROWS);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < SCANS; i++) {
+        debounce(raw, cooked, HALF_ROWS, false);
+        __asm__ volatile("" ::: "memory");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("idle scan:     %6.2f ns\n", elapsed_ns(&start, &end) / SCANS);
+
+    // A row of keys chattering, the timer advancing every 64 scans
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < SCANS; i++) {
+        if ((i & 63) == 0) test_timer++;
+        raw[2] = (i >> 3) & 1 ? 0x55 : 0x2A;
+        debounce(raw, cooked, HALF_ROWS, true);
+        __asm__ volatile("" ::: "memory");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("bouncing scan: %6.2f ns\n", elapsed_ns(&start, &end) / SCANS);
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Host timings of the column reads of the encoder module's matrix scan
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Built twice from hlc_encoder.c: with the single SIO register read, and with
+// HLC_MATRIX_PIN_READS for the gpio_read_pin() per column it replaced. The
+// select and unselect delays are left out, so this times the read itself.
+// Only the relative cost is meaningful, the RP2040 runs the same code at a
+// fraction of the host speed; compare the two builds on the keyboard with
+// HLC_PROFILE. Before timing, every row read is checked against the pins.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "split_util.h"
+
+#ifdef HLC_MATRIX_PIN_READS
+#    define READ_NAME "pin reads"
+#else
+#    define READ_NAME "register read"
+#endif
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+#define SCANS 2000000
+
+sio_hw_t sio_host;
+bool isLeftHand;
+
+void matrix_init_kb(void);
+void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
+
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// Row value the pins give, pressed columns read low
+static matrix_row_t expected_row(const pin_t *pins, uint32_t gpio_in) {
+    matrix_row_t row = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (!((gpio_in >> pins[col]) & 1)) {
+            row |= 1 << col;
+        }
+    }
+    return row;
+}
+
+static bool check_half(const pin_t *pins) {
+    matrix_row_t matrix[ROWS_PER_HAND];
+    uint32_t state = 0x2545F491;
+
+    for (int i = 0; i < 100000; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        sio_host.gpio_in = state;
+
+        matrix_read_cols_on_row(matrix, 0);
+        if (matrix[0] != expected_row(pins, state)) {
+            printf("FAIL gpio_in %08lx read as %02x, expected %02x\n", (unsigned long)state, matrix[0], expected_row(pins, state));
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool bench_half(const char *name, bool left, const pin_t *pins) {
+    matrix_row_t matrix[ROWS_PER_HAND];
+    struct timespec start, end;
+
+    isLeftHand = left;
+    matrix_init_kb();
+    if (!check_half(pins)) {
+        return false;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < SCANS; i++) {
+        sio_host.gpio_in = i & 1 ? 0xFFFFFFFF : 0xFFFFEFBF;
+        for (uint8_t row = 0; row < ROWS_PER_HAND - 1; row++) {
+            matrix_read_cols_on_row(matrix, row);
+        }
+        __asm__ volatile("" ::: "memory");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%s, %s: %6.2f ns per row\n", name, READ_NAME, elapsed_ns(&start, &end) / SCANS / (ROWS_PER_HAND - 1));
+    return true;
+}
+
+int main(void) {
+    static const pin_t left_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+    static const pin_t right_pins[MATRIX_COLS] = MATRIX_COL_PINS_RIGHT;
+
+    bool ok = bench_half("left half ", true, left_pins);
+    ok &= bench_half("right half", false, right_pins);
+    return !ok;
+}
@@ -0,0 +1,6 @@
+// Stand-in for the QMK atomic blocks in the host tests, which run single threaded
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define ATOMIC_BLOCK_FORCEON if (true)
@@ -0,0 +1,10 @@
+// The QMK debounce interface, as implemented by hlc_debounce.c
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void debounce_init(uint8_t num_rows);
+void debounce_free(void);
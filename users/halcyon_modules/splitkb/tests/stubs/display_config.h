@@ -0,0 +1,4 @@
+// Host tests send the surface the blocking way, there is no SPI driver
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#undef LCD_ASYNC_FLUSH
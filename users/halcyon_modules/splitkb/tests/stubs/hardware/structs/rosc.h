@@ -0,0 +1,14 @@
+// Ring oscillator of the host tests, its random bit always reads 0 so seeds
+// only depend on the timer
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t randombit;
+} rosc_hw_t;
+
+static const rosc_hw_t rosc_host = { 0 };
+#define rosc_hw (&rosc_host)
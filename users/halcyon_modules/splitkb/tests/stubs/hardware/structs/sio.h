@@ -0,0 +1,13 @@
+// SIO of the host tests, the test sets the GPIO inputs
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t gpio_in;
+} sio_hw_t;
+
+extern sio_hw_t sio_host;
+#define sio_hw (&sio_host)
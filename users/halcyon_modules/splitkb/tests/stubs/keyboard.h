@@ -0,0 +1,12 @@
+// Stand-in for QMK_KEYBOARD_H in the host tests, a Kyria half pair
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 7
+
+typedef uint8_t matrix_row_t;
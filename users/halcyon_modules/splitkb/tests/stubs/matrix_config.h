@@ -0,0 +1,11 @@
+// Matrix of the host matrix benchmark: the columns on consecutive GPIOs on the
+// left half and in reverse order on the right, as on a mirrored PCB
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#define SPLIT_KEYBOARD
+#define COL2ROW 0
+#define ROW2COL 1
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_ROW_PINS { GP0, GP1, GP3, GP4, GP5 }
+#define MATRIX_COL_PINS { GP6, GP7, GP8, GP9, GP10, GP11, GP12 }
+#define MATRIX_COL_PINS_RIGHT { GP12, GP11, GP10, GP9, GP8, GP7, GP6 }
@@ -0,0 +1,22 @@
+// Stand-in for the Quantum Painter calls of the display code in the host
+// tests. The test emulates the panel behind qp_viewport() and qp_pixdata().
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+typedef const void *painter_device_t;
+typedef enum { QP_ROTATION_0 } painter_rotation_t;
+
+#define HSV_BLACK 0, 0, 0
+
+painter_device_t qp_st7789_make_spi_device(uint16_t width, uint16_t height, pin_t cs, pin_t dc, pin_t reset, uint16_t divisor, int mode);
+bool qp_init(painter_device_t device, painter_rotation_t rotation);
+void qp_set_viewport_offsets(painter_device_t device, uint16_t x, uint16_t y);
+bool qp_clear(painter_device_t device);
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+bool qp_power(painter_device_t device, bool power_on);
+bool qp_flush(painter_device_t device);
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
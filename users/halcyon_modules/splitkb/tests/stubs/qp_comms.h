@@ -0,0 +1,11 @@
+// Stand-in for the Quantum Painter command calls in the host tests, the test
+// panel takes the scroll commands
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp.h"
+
+bool qp_comms_start(painter_device_t device);
+void qp_comms_stop(painter_device_t device);
+bool qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void *data, uint32_t byte_count);
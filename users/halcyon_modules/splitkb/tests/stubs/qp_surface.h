@@ -0,0 +1,10 @@
+// Stand-in for the Quantum Painter surface header in the host tests
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp.h"
+
+#define SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, bpp) ((((width) * (height) * (bpp)) + 7) / 8)
+
+painter_device_t qp_make_rgb565_surface(uint16_t width, uint16_t height, void *buffer);
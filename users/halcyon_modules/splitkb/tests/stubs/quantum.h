@@ -0,0 +1,97 @@
+// Stand-in for the parts of QMK the display and matrix code use in the host
+// tests. The test provides the state behind the functions.
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "keyboard.h"
+#include "hardware/structs/sio.h"
+
+#define GP0 0
+#define GP1 1
+#define GP2 2
+#define GP3 3
+#define GP4 4
+#define GP5 5
+#define GP6 6
+#define GP7 7
+#define GP8 8
+#define GP9 9
+#define GP10 10
+#define GP11 11
+#define GP12 12
+#define GP13 13
+#define GP16 16
+#define GP26 26
+#define GP27 27
+
+typedef uint8_t pin_t;
+#define NO_PIN ((pin_t)0xFF)
+#define PAL_PAD(pin) ((pin) & 0x1F)
+
+// Inputs read the SIO register like palReadLine(), the outputs go nowhere
+static inline bool gpio_read_pin(pin_t pin) {
+    return (sio_hw->gpio_in >> PAL_PAD(pin)) & 1;
+}
+static inline void gpio_set_pin_input_high(pin_t pin) {}
+static inline void gpio_set_pin_output(pin_t pin) {}
+static inline void gpio_write_pin_low(pin_t pin) {}
+static inline void gpio_write_pin_high(pin_t pin) {}
+
+void matrix_output_select_delay(void);
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define TIMER_DIFF_32(a, b) ((uint32_t)((a) - (b)))
+
+#define dprintf(...) ((void)0)
+#define uprintf printf
+
+typedef uint32_t layer_state_t;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+uint8_t get_highest_layer(layer_state_t state);
+
+typedef union {
+    uint8_t raw;
+    struct {
+        bool    num_lock : 1;
+        bool    caps_lock : 1;
+        bool    scroll_lock : 1;
+        bool    compose : 1;
+        bool    kana : 1;
+        uint8_t reserved : 3;
+    };
+} led_t;
+led_t host_keyboard_led_state(void);
+
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+
+uint32_t timer_read32(void);
+uint32_t last_matrix_activity_time(void);
+void backlight_enable(void);
+
+typedef struct {
+    uint8_t r, g, b;
+} rgb_t;
+typedef struct {
+    uint8_t h, s, v;
+} hsv_t;
+rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+// Built with OS_DETECTION_ENABLE like the obbut keymaps
+typedef enum { OS_UNSURE, OS_LINUX, OS_WINDOWS, OS_MACOS, OS_IOS } os_variant_t;
+os_variant_t detected_host_os(void);
+
+#ifdef WPM_ENABLE
+uint8_t get_current_wpm(void);
+const char *get_u8_str(uint8_t curr_num, char curr_pad);
+#endif
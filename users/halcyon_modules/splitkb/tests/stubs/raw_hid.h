@@ -0,0 +1,8 @@
+// Stand-in for the QMK raw HID send call in the host tests, the test keeps the answer
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+void raw_hid_send(uint8_t *data, uint8_t length);
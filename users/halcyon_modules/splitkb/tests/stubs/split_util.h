@@ -0,0 +1,8 @@
+// Stand-in for the QMK split helpers in the host tests, the test picks the half
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+extern bool isLeftHand;
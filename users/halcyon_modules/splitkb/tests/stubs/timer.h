@@ -0,0 +1,14 @@
+// Millisecond timer of the host tests, set by the test
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+extern uint16_t test_timer;
+
+uint32_t timer_read32(void);
+
+static inline uint16_t timer_read(void) {
+    return test_timer;
+}
@@ -0,0 +1,211 @@
+// Bounce traces for hlc_debounce.c, run on the host with a stubbed timer
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Every trace gives the raw state of a few keys, one sample per ms ('1' is
+// pressed, the last sample holds). A trace passes when each key reports one
+// press and one release per real press, the press on the first sample that
+// reads pressed, and the last release exactly the release time after the key
+// settles. Each trace is run from every low byte of the timer, so each of its
+// deadlines lands on both sides of the 8 bit wrap of the debounce timers, and
+// the later runs also cross the 16 bit wrap of timer_read().
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hlc_debounce.h"
+#include "debounce.h"
+#include "timer.h"
+
+#define TRACE_KEYS 4
+#define NO_LATENCY -1
+
+typedef struct {
+    uint8_t     row;
+    uint8_t     col;
+    bool        fast;
+    const char *samples;
+    uint8_t     presses;
+    uint8_t     releases;
+    int16_t     release_latency; // Last release after the last '1' (ms), or NO_LATENCY
+} trace_key_t;
+
+typedef struct {
+    const char *name;
+    trace_key_t keys[TRACE_KEYS];
+} trace_t;
+
+#define KEY(row, col, samples, presses, releases) { row, col, false, samples, presses, releases, HLC_DEBOUNCE_RELEASE }
+#define FAST_KEY(row, col, samples, presses, releases) { row, col, true, samples, presses, releases, HLC_DEBOUNCE_FAST_RELEASE }
+
+static const trace_t traces[] = {
+    { "clean tap", {
+        KEY(0, 1, "000111111111110000000000", 1, 1),
+    } },
+    { "chatter on press", {
+        KEY(0, 1, "0001010111111111100000000000", 1, 1),
+    } },
+    { "chatter on release", {
+        KEY(0, 1, "0001111111111010100000000000", 1, 1),
+    } },
+    { "chatter on both", {
+        KEY(1, 2, "00010111111111111110101000000000000", 1, 1),
+    } },
+    { "slow release chatter", {
+        KEY(1, 2, "00011111111111000010000100000000000", 1, 1),
+    } },
+    { "held key noise", {
+        KEY(2, 0, "00011111111111011111111100111111111101111111110000000000", 1, 1),
+    } },
+    { "quick double tap", {
+        KEY(2, 6, "000111111000000011111110000000000", 2, 2),
+    } },
+    { "fast key tap", {
+        FAST_KEY(3, 3, "000111111111110000000000", 1, 1),
+    } },
+    { "fast key chatter on release", {
+        FAST_KEY(3, 3, "0001111111111010100000000000", 1, 1),
+    } },
+    { "simultaneous keys across rows", {
+        KEY(0, 0, "000111111111111110000000000", 1, 1),
+        KEY(4, 6, "000101011111111111101000000000", 1, 1),
+        FAST_KEY(7, 3, "000111111111010100000000000", 1, 1),
+        KEY(9, 4, "000110111111111111111111100000000000", 1, 1),
+    } },
+    { "same row, different times", {
+        KEY(5, 1, "0001111111111111100000000000000", 1, 1),
+        KEY(5, 2, "0000000111111111111111000000000", 1, 1),
+        FAST_KEY(5, 6, "0000011111111100000000000000000", 1, 1),
+    } },
+    { "held past the deadline wrap", {
+        KEY(6, 5, "000"
+                  "1111111111111111111111111111111111111111111111111111111111111111"
+                  "1111111111111111111111111111111111111111111111111111111111111111"
+                  "1111111111111111111111111111111111111111111111111111111111111111"
+                  "1111111111111111111111111111111111111111111111111111111111111111"
+                  "1111111111111111111111111111111111111111111111111111111111111111"
+                  "00000000000", 1, 1),
+    } },
+};
+
+// First start value of the ms timer, a run starts from each of the 256 after it
+#define FIRST_START_TIME 65280
+
+uint16_t test_timer;
+static matrix_row_t fast_keys[MATRIX_ROWS];
+
+matrix_row_t debounce_fast_keys_user(uint8_t row) {
+    return fast_keys[row];
+}
+
+static char sample_at(const char *samples, size_t t) {
+    size_t length = strlen(samples);
+    return samples[t < length ? t : length - 1];
+}
+
+static size_t trace_length(const trace_t *trace) {
+    size_t length = 0;
+    for (uint8_t k = 0; k < TRACE_KEYS && trace->keys[k].samples; k++) {
+        size_t key_length = strlen(trace->keys[k].samples);
+        if (key_length > length) length = key_length;
+    }
+    // Room for the last release
+    return length + 2 * HLC_DEBOUNCE_RELEASE;
+}
+
+static bool run_trace(const trace_t *trace, uint16_t start_time) {
+    matrix_row_t raw[MATRIX_ROWS] = { 0 };
+    matrix_row_t cooked[MATRIX_ROWS] = { 0 };
+    int presses[TRACE_KEYS] = { 0 };
+    int releases[TRACE_KEYS] = { 0 };
+    int first_press[TRACE_KEYS];
+    int last_release[TRACE_KEYS];
+    bool ok = true;
+
+    memset(fast_keys, 0, sizeof(fast_keys));
+    for (uint8_t k = 0; k < TRACE_KEYS && trace->keys[k].samples; k++) {
+        if (trace->keys[k].fast) {
+            fast_keys[trace->keys[k].row] |= 1 << trace->keys[k].col;
+        }
+        first_press[k] = -1;
+        last_release[k] = -1;
+    }
+
+    test_timer = start_time;
+    debounce_init(MATRIX_ROWS);
+
+    size_t length = trace_length(trace);
+    for (size_t t = 0; t < length; t++, test_timer++) {
+        matrix_row_t previous_raw[MATRIX_ROWS];
+        matrix_row_t previous_cooked[MATRIX_ROWS];
+        memcpy(previous_raw, raw, sizeof(raw));
+        memcpy(previous_cooked, cooked, sizeof(cooked));
+
+        memset(raw, 0, sizeof(raw));
+        for (uint8_t k = 0; k < TRACE_KEYS && trace->keys[k].samples; k++) {
+            if (sample_at(trace->keys[k].samples, t) == '1') {
+                raw[trace->keys[k].row] |= 1 << trace->keys[k].col;
+            }
+        }
+
+        bool changed = memcmp(raw, previous_raw, sizeof(raw)) != 0;
+        bool reported = debounce(raw, cooked, MATRIX_ROWS, changed);
+        if (reported != (memcmp(cooked, previous_cooked, sizeof(cooked)) != 0)) {
+            printf("  %zu ms: debounce() returned %d\n", t, reported);
+            ok = false;
+        }
+
+        for (uint8_t k = 0; k < TRACE_KEYS && trace->keys[k].samples; k++) {
+            matrix_row_t bit = 1 << trace->keys[k].col;
+            bool was = previous_cooked[trace->keys[k].row] & bit;
+            bool is = cooked[trace->keys[k].row] & bit;
+            if (!was && is) {
+                if (first_press[k] < 0) first_press[k] = t;
+                presses[k]++;
+            }
+            if (was && !is) {
+                last_release[k] = t;
+                releases[k]++;
+            }
+        }
+    }
+
+    for (uint8_t k = 0; k < TRACE_KEYS && trace->keys[k].samples; k++) {
+        const trace_key_t *key = &trace->keys[k];
+        int first_one = strchr(key->samples, '1') - key->samples;
+        int last_one = strrchr(key->samples, '1') - key->samples;
+
+        if (presses[k] != key->presses || releases[k] != key->releases) {
+            printf("  key %u,%u: %d presses, %d releases, expected %u and %u\n", key->row, key->col, presses[k], releases[k], key->presses, key->releases);
+            ok = false;
+        }
+        if (first_press[k] != first_one) {
+            printf("  key %u,%u: press reported at %d ms, read at %d ms\n", key->row, key->col, first_press[k], first_one);
+            ok = false;
+        }
+        if (key->release_latency != NO_LATENCY && last_release[k] - (last_one + 1) != key->release_latency) {
+            printf("  key %u,%u: released %d ms after it settled, expected %d ms\n", key->row, key->col, last_release[k] - (last_one + 1), key->release_latency);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(void) {
+    int failed = 0;
+
+    for (size_t i = 0; i < sizeof(traces) / sizeof(traces[0]); i++) {
+        bool ok = true;
+        for (uint16_t s = 0; s < 256; s++) {
+            uint16_t start_time = FIRST_START_TIME + s;
+            if (!run_trace(&traces[i], start_time)) {
+                printf("  timer from %u\n", start_time);
+                ok = false;
+            }
+        }
+        printf("%-4s %s\n", ok ? "ok" : "FAIL", traces[i].name);
+        failed += !ok;
+    }
+
+    printf("%d failed\n", failed);
+    return failed != 0;
+}
@@ -0,0 +1,677 @@
+// Golden frames of the TFT display renderer, run on the host
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Builds hlc_tft_display.c, the surface, the widgets and the assets against
+// stubbed QMK and Quantum Painter calls. The stubbed panel keeps what the
+// flushes send through qp_viewport() and qp_pixdata() in its memory and shows
+// it through the vertical scroll commands, so a frame is what the lcd would
+// show, dirty region tracking and all. Every scenario renders until the display
+// is idle and compares a hash of the screen with the golden file:
+//
+//   test_display                  compare with the golden file
+//   test_display --update         rewrite the golden file from this build
+//   test_display --frames DIR     also write every frame to DIR as a PPM image
+//
+// The master scenarios run in order on one display, like key presses on a
+// keyboard. Every Game of Life seed gets a fresh process. The Makefile also
+// builds it with HLC_WPM_HISTORY, against its own golden file.
+
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "halcyon.h"
+#include "hlc_tft_display.h"
+#include "raw_hid.h"
+
+#ifndef GOLDEN_FILE
+#    define GOLDEN_FILE "golden/display_frames.txt"
+#endif
+#define MAX_FRAMES 64
+
+// Stubbed keyboard state
+
+layer_state_t layer_state = 0;
+layer_state_t default_layer_state = 1;
+static led_t led_state = { .raw = 0 };
+static uint8_t mods = 0;
+static os_variant_t host_os = OS_LINUX;
+#ifdef WPM_ENABLE
+static uint8_t wpm = 0;
+#endif
+static uint32_t now_ms = 0;
+
+uint8_t get_highest_layer(layer_state_t state) {
+    return state ? 31 - __builtin_clz(state) : 0;
+}
+
+led_t host_keyboard_led_state(void) {
+    return led_state;
+}
+
+uint8_t get_mods(void) {
+    return mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return 0;
+}
+
+os_variant_t detected_host_os(void) {
+    return host_os;
+}
+
+#ifdef WPM_ENABLE
+uint8_t get_current_wpm(void) {
+    return wpm;
+}
+
+const char *get_u8_str(uint8_t curr_num, char curr_pad) {
+    static char buf[4];
+    snprintf(buf, sizeof(buf), "%3u", curr_num);
+    for (char *c = buf; *c == ' '; c++) *c = curr_pad;
+    return buf;
+}
+#endif
+
+uint32_t timer_read32(void) {
+    return now_ms;
+}
+
+uint32_t last_matrix_activity_time(void) {
+    return 0;
+}
+
+void backlight_enable(void) {}
+
+// Same conversion as QMK without the CIE curve
+rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
+    if (hsv.s == 0) {
+        return (rgb_t){ hsv.v, hsv.v, hsv.v };
+    }
+
+    uint16_t h = hsv.h, s = hsv.s, v = hsv.v;
+    uint8_t region = h * 6 / 255;
+    uint8_t remainder = (h * 2 - region * 85) * 3;
+    uint8_t p = (v * (255 - s)) >> 8;
+    uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            return (rgb_t){ v, t, p };
+        case 1:
+            return (rgb_t){ q, v, p };
+        case 2:
+            return (rgb_t){ p, v, t };
+        case 3:
+            return (rgb_t){ p, q, v };
+        case 4:
+            return (rgb_t){ t, p, v };
+        default:
+            return (rgb_t){ v, p, q };
+    }
+}
+
+// Stubbed halcyon.c
+
+// Suspend hooks of the module, declared in halcyon.c itself
+void module_suspend_power_down_kb(void);
+void module_suspend_wakeup_init_kb(void);
+
+uint32_t hlc_timer_read32(void) {
+    return now_ms;
+}
+
+// Every read moves the us timer on by us_step. At 0 the pass budget never
+// runs out and a pass does all the work there is.
+static uint32_t now_us = 0;
+static uint32_t us_step = 0;
+
+uint32_t hlc_timer_read_us(void) {
+    return now_us += us_step;
+}
+
+bool hlc_timer_tick(uint32_t *last_slot, uint32_t period) {
+    uint32_t slot = hlc_timer_read32() / period;
+
+    if (slot == *last_slot) {
+        return false;
+    }
+    *last_slot = slot;
+    return true;
+}
+
+bool display_module_housekeeping_task_user(bool second_display) {
+    return true;
+}
+
+bool module_post_init_user(void) {
+    return true;
+}
+
+// Stubbed panel, in native byte swapped rgb565 like the ST7789 memory. Only
+// the columns of the display are kept, but all 320 rows, which the vertical
+// scroll commands rotate.
+
+#define PANEL_ROWS 320
+#define PANEL_SCROLL_AREA 0x33
+#define PANEL_SCROLL_START 0x37
+
+static uint16_t panel[PANEL_ROWS][LCD_WIDTH];
+static uint16_t offset_x, offset_y;
+static uint16_t window_left, window_top, window_right, window_bottom;
+static uint16_t window_x, window_y;
+static uint16_t top_fixed = 0, scrolled = PANEL_ROWS, scroll_start = 0;
+static bool comms_started = false;
+static bool panel_powered = false;
+static int check_failures = 0;
+
+painter_device_t qp_st7789_make_spi_device(uint16_t width, uint16_t height, pin_t cs, pin_t dc, pin_t reset, uint16_t divisor, int mode) {
+    return panel;
+}
+
+bool qp_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+void qp_set_viewport_offsets(painter_device_t device, uint16_t x, uint16_t y) {
+    offset_x = x;
+    offset_y = y;
+}
+
+bool qp_clear(painter_device_t device) {
+    return true;
+}
+
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    return true;
+}
+
+// The SPI bus belongs to the flush while a frame is going out
+bool qp_power(painter_device_t device, bool power_on) {
+    if (display_is_flushing()) {
+        printf("  panel power switched while a frame is going out\n");
+        check_failures++;
+        return false;
+    }
+    panel_powered = power_on;
+    return true;
+}
+
+bool qp_flush(painter_device_t device) {
+    return true;
+}
+
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    if (left > right || top > bottom || right >= LCD_WIDTH || bottom >= LCD_HEIGHT) {
+        check_failures++;
+        return false;
+    }
+    window_left = window_x = left;
+    window_top = window_y = top + offset_y;
+    window_right = right;
+    window_bottom = bottom + offset_y;
+    return true;
+}
+
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint16_t *pixels = pixel_data;
+
+    for (uint32_t i = 0; i < native_pixel_count; i++) {
+        if (window_y > window_bottom) {
+            check_failures++;
+            return false;
+        }
+        panel[window_y][window_x] = pixels[i];
+        if (window_x++ == window_right) {
+            window_x = window_left;
+            window_y++;
+        }
+    }
+    return true;
+}
+
+bool qp_comms_start(painter_device_t device) {
+    comms_started = true;
+    return true;
+}
+
+void qp_comms_stop(painter_device_t device) {
+    comms_started = false;
+}
+
+bool qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void *data, uint32_t byte_count) {
+    const uint8_t *bytes = data;
+
+    if (!comms_started) {
+        check_failures++;
+        return false;
+    }
+    if (cmd == PANEL_SCROLL_AREA && byte_count == 6) {
+        top_fixed = bytes[0] << 8 | bytes[1];
+        scrolled = bytes[2] << 8 | bytes[3];
+        if (top_fixed + scrolled + (bytes[4] << 8 | bytes[5]) != PANEL_ROWS) {
+            check_failures++;
+        }
+    } else if (cmd == PANEL_SCROLL_START && byte_count == 2) {
+        scroll_start = bytes[0] << 8 | bytes[1];
+    } else {
+        check_failures++;
+        return false;
+    }
+    return true;
+}
+
+// Panel memory row shown on a screen row
+static const uint16_t *screen_row(uint16_t y) {
+    uint16_t line = y + offset_y;
+
+    if (line >= top_fixed && line < top_fixed + scrolled) {
+        line = top_fixed + (scroll_start - top_fixed + line - top_fixed) % scrolled;
+    }
+    return panel[line];
+}
+
+painter_device_t qp_make_rgb565_surface(uint16_t width, uint16_t height, void *buffer) {
+    return buffer;
+}
+
+// Raw HID, the answers of the display
+
+#define HID_DISPLAY_ID 0x48
+#define HID_REPORT_SIZE 32
+
+enum { HOST_BEGIN = 1, HOST_RLE, HOST_TEXT, HOST_END };
+
+static uint8_t hid_answer[HID_REPORT_SIZE];
+static uint8_t host_sequence = 0;
+
+void raw_hid_send(uint8_t *data, uint8_t length) {
+    memcpy(hid_answer, data, MIN(length, sizeof(hid_answer)));
+}
+
+// Sends a display report like the host does, the answer must be OK
+static void host_send(uint8_t op, const uint8_t *payload, uint8_t length) {
+    uint8_t report[HID_REPORT_SIZE] = { HID_DISPLAY_ID, op, host_sequence };
+    memcpy(&report[3], payload, length);
+
+    if (!display_hid_receive(report, sizeof(report)) || hid_answer[3] != 0) {
+        printf("  host report %u: status %u\n", op, hid_answer[3]);
+        check_failures++;
+    }
+    host_sequence = hid_answer[4];
+}
+
+// Frames
+
+typedef struct {
+    char     name[48];
+    uint32_t hash;
+} frame_t;
+
+static frame_t frames[MAX_FRAMES];
+static int frame_count = 0;
+static const char *frame_dir = NULL;
+
+// FNV-1a over the screen
+static uint32_t screen_hash(void) {
+    uint32_t hash = 2166136261u;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        const uint8_t *bytes = (const uint8_t *)screen_row(y);
+        for (size_t i = 0; i < LCD_WIDTH * sizeof(uint16_t); i++) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static void write_ppm(const char *name) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", frame_dir, name);
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        perror(path);
+        return;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", LCD_WIDTH, LCD_HEIGHT);
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        const uint16_t *row = screen_row(y);
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            uint16_t rgb565 = __builtin_bswap16(row[x]);
+            uint8_t rgb[3] = { (rgb565 >> 11) << 3, ((rgb565 >> 5) & 0x3F) << 2, (rgb565 & 0x1F) << 3 };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+    fclose(file);
+}
+
+// Runs housekeeping passes until everything drawn has reached the panel
+static void render(bool second_display) {
+    for (int pass = 0; pass < 1000; pass++) {
+        display_module_housekeeping_task_kb(second_display);
+        if (!display_is_dirty() && !display_is_flushing()) {
+            return;
+        }
+    }
+    printf("  display never went idle\n");
+    check_failures++;
+}
+
+static void capture(const char *name) {
+    frame_t *frame = &frames[frame_count++];
+    snprintf(frame->name, sizeof(frame->name), "%s", name);
+    frame->hash = screen_hash();
+    if (frame_dir) {
+        write_ppm(name);
+    }
+}
+
+static void master_scenarios(void) {
+    static const char *const lock_names[] = { "none", "num", "caps", "caps_num", "scroll", "num_scroll", "caps_scroll", "all" };
+    char name[48];
+
+    module_post_init_kb();
+
+    for (uint8_t layer = 0; layer <= 8; layer++) {
+        layer_state = layer ? 1UL << layer : 0;
+        render(false);
+        snprintf(name, sizeof(name), "master_layer_%u", layer);
+        capture(name);
+    }
+    layer_state = 0;
+
+    for (uint8_t locks = 1; locks < 8; locks++) {
+        led_state.raw = locks;
+        render(false);
+        snprintf(name, sizeof(name), "master_locks_%s", lock_names[locks]);
+        capture(name);
+    }
+    led_state.raw = 0;
+
+    mods = 0x01 | 0x20; // Left ctrl, right shift
+    now_ms += 1000;     // Past the refresh interval of the mods
+    render(false);
+    capture("master_mods_ctrl_shift");
+    mods = 0;
+    now_ms += 1000;
+    render(false);
+}
+
+// A host frame over the layer number and text next to it, then a layer change
+// under it, then the host going quiet
+static void host_scenarios(void) {
+    static const uint8_t region[] = { 60, 30, 60, 40 };
+    static const uint8_t text[] = { 84, 80, 2, 0xF8, 0x00, 'H', 'O', 'S', 'T', 0 };
+    uint8_t runs[27];
+
+    host_send(HOST_BEGIN, region, sizeof(region));
+    for (uint8_t row = 0; row < region[3]; row += 9) {
+        uint8_t count = MIN(9, region[3] - row);
+        for (uint8_t i = 0; i < count; i++) {
+            bool blue = (row + i) / 10 & 1;
+            runs[i * 3] = region[2];
+            runs[i * 3 + 1] = blue ? 0x00 : 0x07;
+            runs[i * 3 + 2] = blue ? 0x1F : 0xE0;
+        }
+        host_send(HOST_RLE, runs, count * 3);
+    }
+    host_send(HOST_TEXT, text, sizeof(text));
+    host_send(HOST_END, NULL, 0);
+    render(false);
+    capture("master_host_frame");
+    uint32_t host_frame = frames[frame_count - 1].hash;
+
+    layer_state = 1UL << 2;
+    now_ms += 100;
+    render(false);
+    capture("master_host_layer_hidden");
+    if (frames[frame_count - 1].hash != host_frame) {
+        printf("  the layer number drew over the host frame\n");
+        check_failures++;
+    }
+
+    now_ms += HLC_DISPLAY_HID_HOLD;
+    render(false);
+    capture("master_host_released");
+    for (int i = 0; i < frame_count; i++) {
+        if (strcmp(frames[i].name, "master_layer_2") == 0 && frames[i].hash != frames[frame_count - 1].hash) {
+            printf("  the widgets did not come back after the host frame\n");
+            check_failures++;
+        }
+    }
+    layer_state = 0;
+}
+
+// Frame hash captured earlier under the given name
+static uint32_t frame_hash(const char *name) {
+    for (int i = 0; i < frame_count; i++) {
+        if (strcmp(frames[i].name, name) == 0) return frames[i].hash;
+    }
+    return 0;
+}
+
+// Suspends and wakes up while a layer change is going out, passes are cut
+// short by the budget so the frame takes several of them
+static void suspend_scenarios(void) {
+    layer_state = 1UL << 3;
+    us_step = HLC_DISPLAY_PASS_BUDGET_US / 4;
+    for (int pass = 0; pass < 1000 && !display_is_flushing(); pass++) {
+        display_module_housekeeping_task_kb(false);
+    }
+
+    // Woken up before the frame is out, the panel never went off
+    module_suspend_power_down_kb();
+    if (!display_is_flushing()) {
+        printf("  the frame went out before the suspend\n");
+        check_failures++;
+    }
+    module_suspend_wakeup_init_kb();
+    render(false);
+    capture("master_wakeup_during_flush");
+    if (frame_hash("master_wakeup_during_flush") != frame_hash("master_layer_3") || !panel_powered) {
+        printf("  the frame sent around a short suspend differs\n");
+        check_failures++;
+    }
+
+    // A long suspend, the panel goes off once the frame is out
+    layer_state = 1UL << 4;
+    for (int pass = 0; pass < 1000 && !display_is_flushing(); pass++) {
+        display_module_housekeeping_task_kb(false);
+    }
+    for (int call = 0; call < 1000 && panel_powered; call++) {
+        module_suspend_power_down_kb();
+    }
+    module_suspend_wakeup_init_kb();
+    render(false);
+    capture("master_wakeup_after_suspend");
+    if (frame_hash("master_wakeup_after_suspend") != frame_hash("master_layer_4") || !panel_powered) {
+        printf("  the panel did not come back after a suspend\n");
+        check_failures++;
+    }
+
+    us_step = 0;
+    layer_state = 0;
+    render(false);
+}
+
+// Game of Life from a seed, after a few generations
+static void life_scenario(uint32_t seed, uint8_t generations) {
+    char name[48];
+
+    now_ms = seed;
+    module_post_init_kb();
+    for (uint8_t generation = 0; generation <= generations; generation++) {
+        render(true);
+        now_ms += HLC_DISPLAY_FRAME_INTERVAL;
+    }
+    snprintf(name, sizeof(name), "life_seed_%lu_gen_%u", (unsigned long)seed, generations);
+    capture(name);
+}
+
+#ifdef HLC_WPM_HISTORY
+static uint8_t wpm_sample(uint8_t line) {
+    return line * 37 % 200;
+}
+
+// WPM history after the given number of lines, more than fit in the band so
+// the scroll offset wraps. Also checks each row of the band against its sample.
+static void wpm_history_scenario(uint32_t seed, uint8_t lines) {
+    char name[48];
+
+    now_ms = seed;
+    module_post_init_kb();
+    render(true);
+    for (uint8_t line = 0; line < lines; line++) {
+        now_ms += HLC_WPM_HISTORY_INTERVAL;
+        wpm = wpm_sample(line);
+        render(true);
+    }
+
+    for (uint8_t k = 0; k < HLC_WPM_HISTORY_HEIGHT && k < lines; k++) {
+        const uint16_t *row = screen_row(LCD_HEIGHT - 1 - k);
+        uint16_t expected = MIN(wpm_sample(lines - 1 - k), HLC_WPM_HISTORY_MAX) * LCD_WIDTH / HLC_WPM_HISTORY_MAX;
+        uint16_t length = 0;
+        while (length < LCD_WIDTH && row[length]) length++;
+        for (uint16_t x = length; x < LCD_WIDTH; x++) {
+            if (row[x]) length = UINT16_MAX;
+        }
+        if (length != expected) {
+            printf("  wpm history row %u from the bottom: %u pixels, expected %u\n", k, length, expected);
+            check_failures++;
+        }
+    }
+
+    snprintf(name, sizeof(name), "wpm_history_seed_%lu_lines_%u", (unsigned long)seed, lines);
+    capture(name);
+}
+#endif
+
+// Renders a scenario in a child process, the display code keeps its state in
+// statics. The child reports its frame through a pipe.
+static void run_isolated(void (*scenario)(uint32_t seed, uint8_t steps), uint32_t seed, uint8_t steps) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(2);
+    }
+    fflush(stdout);
+
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        frame_count = 0;
+        scenario(seed, steps);
+        fflush(stdout);
+        if (write(fds[1], &frames[0], sizeof(frame_t)) != sizeof(frame_t) || check_failures) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], &frames[frame_count], sizeof(frame_t)) == sizeof(frame_t)) {
+        frame_count++;
+    }
+    close(fds[0]);
+
+    int status;
+    waitpid(child, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        check_failures++;
+    }
+}
+
+static void isolated_scenarios(void) {
+    static const uint32_t seeds[] = { 1, 4242, 90000 };
+    static const uint8_t generations[] = { 0, 1, 10 };
+
+    for (size_t s = 0; s < ARRAY_SIZE(seeds); s++) {
+        for (size_t g = 0; g < ARRAY_SIZE(generations); g++) {
+            run_isolated(life_scenario, seeds[s], generations[g]);
+        }
+    }
+#ifdef HLC_WPM_HISTORY
+    run_isolated(wpm_history_scenario, 1, 10);
+    run_isolated(wpm_history_scenario, 4242, 60);
+#endif
+}
+
+static int compare_golden(void) {
+    FILE *file = fopen(GOLDEN_FILE, "r");
+    if (!file) {
+        perror(GOLDEN_FILE);
+        return 1;
+    }
+
+    char name[48];
+    unsigned long hash;
+    int failed = 0;
+    int found = 0;
+    while (fscanf(file, "%47s %lx", name, &hash) == 2) {
+        int i = 0;
+        while (i < frame_count && strcmp(frames[i].name, name) != 0) i++;
+        if (i == frame_count) {
+            printf("FAIL %s: not rendered\n", name);
+            failed++;
+            continue;
+        }
+        found++;
+        bool ok = frames[i].hash == hash;
+        printf("%-4s %s\n", ok ? "ok" : "FAIL", name);
+        failed += !ok;
+    }
+    fclose(file);
+
+    if (found != frame_count) {
+        printf("FAIL %d frames are missing from " GOLDEN_FILE "\n", frame_count - found);
+        failed++;
+    }
+    return failed;
+}
+
+static int update_golden(void) {
+    FILE *file = fopen(GOLDEN_FILE, "w");
+    if (!file) {
+        perror(GOLDEN_FILE);
+        return 1;
+    }
+    for (int i = 0; i < frame_count; i++) {
+        fprintf(file, "%s %08lx\n", frames[i].name, (unsigned long)frames[i].hash);
+    }
+    fclose(file);
+    printf("wrote %d frames to " GOLDEN_FILE "\n", frame_count);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    bool update = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frame_dir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--update] [--frames DIR]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    master_scenarios();
+    host_scenarios();
+    suspend_scenarios();
+    isolated_scenarios();
+
+    if (check_failures) {
+        printf("FAIL %d checks of the panel, the host reports or the scenarios\n", check_failures);
+        return 1;
+    }
+
+    int failed = update ? update_golden() : compare_golden();
+    printf("%d failed\n", failed);
+    return failed != 0;
+}
@@ -2,6 +2,14 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "obbut_halcyon.h"
+#include "hlc_idle.h"
+#ifdef HLC_DEBOUNCE
+#    include "hlc_debounce.h"
+#endif
+#ifdef HLC_PROFILE
+#    include "halcyon.h"
+#    include "hlc_profile.h"
+#endif
 
 // ============== POINTING DEVICE SETTINGS ==============
 
@@ -42,8 +50,8 @@ void obbut_housekeeping_task(void) {
         static bool last_rgb_preview_mode = false;
         static uint32_t last_sync = 0;
 
-        // Sync when state changes or every 500ms
-        if (rgb_preview_mode != last_rgb_preview_mode || timer_elapsed32(last_sync) > 500) {
+        // Sync when state changes or every 500ms, less often while idle
+        if (rgb_preview_mode != last_rgb_preview_mode || timer_elapsed32(last_sync) > hlc_idle_sync_interval(500)) {
             if (transaction_rpc_send(USER_SYNC_RGB_PREVIEW, sizeof(rgb_preview_mode), &rgb_preview_mode)) {
                 last_rgb_preview_mode = rgb_preview_mode;
                 last_sync = timer_read32();
@@ -58,9 +66,80 @@ static inline bool is_windows(void) {
     return detected_host_os() == OS_WINDOWS;
 }
 
+// ============== DEBOUNCE ==============
+
+#ifdef HLC_DEBOUNCE
+// Gaming on the QWERTY layer, every key debounces with the fast times
+matrix_row_t debounce_fast_keys_user(uint8_t row) {
+    return layer_state_is(_QWERTY) ? (matrix_row_t)~0 : 0;
+}
+#endif
+
+// ============== ENCODER ACCELERATION ==============
+// Fast spins on a volume encoder send several steps per detent. Detents
+// further apart than the last interval, or in a new direction, stay single steps.
+
+#ifdef ENCODER_MAP_ENABLE
+static const struct {
+    uint16_t interval; // Time since the previous detent (ms)
+    uint8_t  steps;
+} encoder_acceleration[] = {
+    { 30, 4 },
+    { 60, 2 },
+};
+
+static uint16_t last_detent_time[NUM_ENCODERS];
+static uint8_t  last_detent_type[NUM_ENCODERS];
+
+static uint8_t encoder_steps(keyevent_t *event) {
+    uint8_t  index    = event->key.col;
+    uint16_t interval = TIMER_DIFF_16(event->time, last_detent_time[index]);
+    bool     same_way = event->type == last_detent_type[index];
+    uint8_t  steps    = 1;
+
+    last_detent_time[index] = event->time;
+    last_detent_type[index] = event->type;
+
+    if (same_way) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(encoder_acceleration); i++) {
+            if (interval < encoder_acceleration[i].interval) {
+                steps = encoder_acceleration[i].steps;
+                break;
+            }
+        }
+    }
+    return steps;
+}
+
+// Sends the steps past the first, the detent itself goes through as usual
+static void encoder_accelerate(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed || !IS_ENCODEREVENT(record->event) || record->event.key.col >= NUM_ENCODERS) {
+        return;
+    }
+
+    switch (keycode) {
+        case KC_KB_VOLUME_UP:
+        case KC_KB_VOLUME_DOWN: {
+            uint8_t steps = encoder_steps(&record->event);
+            if (is_windows()) {
+                keycode = keycode == KC_KB_VOLUME_UP ? KC_VOLU : KC_VOLD;
+            }
+            for (uint8_t i = 1; i < steps; i++) {
+                tap_code(keycode);
+            }
+            break;
+        }
+    }
+}
+#endif
+
 // ============== KEY PROCESSING ==============
 
 bool obbut_process_record(uint16_t keycode, keyrecord_t *record) {
+#ifdef ENCODER_MAP_ENABLE
+    encoder_accelerate(keycode, record);
+#endif
+
     // When pressing RGB control keys on Function layer, enable preview mode
     if (record->event.pressed && get_highest_layer(layer_state) == _FUNCTION) {
         switch (keycode) {
@@ -181,7 +260,7 @@ report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) {
 // ============== RGB MATRIX INDICATORS ==============
 
 #if defined(RGB_MATRIX_ENABLE)
-bool obbut_rgb_matrix_indicators(uint8_t led_min, uint8_t led_max) {
+static bool draw_indicators(uint8_t led_min, uint8_t led_max) {
     uint8_t layer = get_highest_layer(layer_state);
 
     // Skip Function layer indicators if in preview mode
@@ -318,4 +397,15 @@ bool obbut_rgb_matrix_indicators(uint8_t led_min, uint8_t led_max) {
     }
     return false;
 }
+
+bool obbut_rgb_matrix_indicators(uint8_t led_min, uint8_t led_max) {
+#ifdef HLC_PROFILE
+    uint32_t start = hlc_timer_read_us();
+    bool result = draw_indicators(led_min, led_max);
+    hlc_profile_end(HLC_PROFILE_INDICATORS, start);
+    return result;
+#else
+    return draw_indicators(led_min, led_max);
+#endif
+}
 #endif